@@ -0,0 +1,301 @@
+#include "algorithms/clipping/rectclip.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace algorithms
+{
+
+namespace
+{
+
+constexpr double infinity = std::numeric_limits<double>::infinity();
+
+// Range [enter, exit] of the parameters t at which start + t * delta lies between <min> and <max>. Written
+// with selects instead of branches so that it can be inlined into vectorised loops.
+inline void getSlabParameters(double start, double delta, double min, double max, double& enter, double& exit)
+{
+    double inverseDelta = 1. / delta;
+    double toMin = (min - start) * inverseDelta;
+    double toMax = (max - start) * inverseDelta;
+    bool isParallel = delta == 0.;
+    bool isInside = start >= min && start <= max;
+    enter = isParallel ? (isInside ? -infinity : infinity) : std::min(toMin, toMax);
+    exit = isParallel ? (isInside ? infinity : -infinity) : std::max(toMin, toMax);
+}
+
+inline void getClipParameters(double startX, double startY, double endX, double endY,
+                              double minX, double minY, double maxX, double maxY, double& enter, double& exit)
+{
+    double enterX, exitX, enterY, exitY;
+    getSlabParameters(startX, endX - startX, minX, maxX, enterX, exitX);
+    getSlabParameters(startY, endY - startY, minY, maxY, enterY, exitY);
+    enter = std::max(std::max(0., enterX), enterY);
+    exit = std::min(std::min(1., exitX), exitY);
+}
+
+CoordinateArrays toCoordinateArrays(const primitives::Polygon& polygon)
+{
+    CoordinateArrays ring;
+    ring.xs.reserve(polygon.size());
+    ring.ys.reserve(polygon.size());
+    for (size_t i = 0; i < polygon.size(); ++i)
+    {
+        auto vertex = polygon.getVertex(i);
+        ring.push_back(vertex.x(), vertex.y());
+    }
+    return ring;
+}
+
+// Removes repeated vertices, including the last one repeating the first, and clears rings left with
+// fewer than three vertices.
+void removeRepeatedVertices(CoordinateArrays& ring)
+{
+    CoordinateArrays result;
+    for (size_t i = 0; i < ring.size(); ++i)
+    {
+        if (result.size() > 0 && result.xs.back() == ring.xs[i] && result.ys.back() == ring.ys[i]) continue;
+        result.push_back(ring.xs[i], ring.ys[i]);
+    }
+    while (result.size() > 1 && result.xs.back() == result.xs.front() && result.ys.back() == result.ys.front())
+    {
+        result.xs.pop_back();
+        result.ys.pop_back();
+    }
+    if (result.size() < 3)
+    {
+        result = CoordinateArrays();
+    }
+    ring = std::move(result);
+}
+
+// One stage of Sutherland-Hodgman, keeping the part of <ring> where the coordinate along the given axis is
+// at least (isLowerBound) resp. at most <bound>.
+CoordinateArrays clipToHalfPlane(const CoordinateArrays& ring, bool isAlongX, double bound, bool isLowerBound)
+{
+    size_t size = ring.size();
+    if (size == 0) return {};
+
+    // Signed distances to the boundary, positive inside.
+    const double* coordinates = isAlongX ? ring.xs.data() : ring.ys.data();
+    double sign = isLowerBound ? 1. : -1.;
+    std::vector<double> distances(size);
+    for (size_t i = 0; i < size; ++i)
+    {
+        distances[i] = sign * (coordinates[i] - bound);
+    }
+
+    CoordinateArrays result;
+    result.xs.reserve(size + 2);
+    result.ys.reserve(size + 2);
+    for (size_t i = 0; i < size; ++i)
+    {
+        size_t next = i + 1 < size ? i + 1 : 0;
+        bool isInside = distances[i] >= 0.;
+        if (isInside)
+        {
+            result.push_back(ring.xs[i], ring.ys[i]);
+        }
+        if (isInside != (distances[next] >= 0.))
+        {
+            double t = distances[i] / (distances[i] - distances[next]);
+            double x = isAlongX ? bound : ring.xs[i] + t * (ring.xs[next] - ring.xs[i]);
+            double y = isAlongX ? ring.ys[i] + t * (ring.ys[next] - ring.ys[i]) : bound;
+            result.push_back(x, y);
+        }
+    }
+    return result;
+}
+
+struct Slab
+{
+    size_t index;
+    CoordinateArrays ring;
+};
+
+// Splits <ring> into the slabs [origin + k * slabSize, origin + (k + 1) * slabSize], k = 0, ..., numSlabs - 1,
+// along the given axis. Every vertex goes to the slab containing it, and every crossing of an edge with a slab
+// boundary to the slabs on both sides, which for each slab is what Sutherland-Hodgman clipping against its two
+// boundaries gives. Only the slabs between the ones of the leftmost and rightmost vertex can be reached, and
+// only the non-empty ones among them are returned, ordered by index.
+std::vector<Slab> splitIntoSlabs(const CoordinateArrays& ring, bool isAlongX, double origin, double slabSize, size_t numSlabs)
+{
+    size_t size = ring.size();
+    const double* coordinates = isAlongX ? ring.xs.data() : ring.ys.data();
+    const double* otherCoordinates = isAlongX ? ring.ys.data() : ring.xs.data();
+
+    // Slab per vertex, with -1 and numSlabs for vertices outside of the grid.
+    std::vector<int64_t> slabs(size);
+    double inverseSlabSize = 1. / slabSize;
+    double maxSlab = static_cast<double>(numSlabs);
+    int64_t firstSlab = static_cast<int64_t>(numSlabs);
+    int64_t lastSlab = -1;
+    for (size_t i = 0; i < size; ++i)
+    {
+        slabs[i] = static_cast<int64_t>(std::clamp(std::floor((coordinates[i] - origin) * inverseSlabSize), -1., maxSlab));
+        firstSlab = std::min(firstSlab, slabs[i]);
+        lastSlab = std::max(lastSlab, slabs[i]);
+    }
+    firstSlab = std::max<int64_t>(firstSlab, 0);
+    lastSlab = std::min<int64_t>(lastSlab, static_cast<int64_t>(numSlabs) - 1);
+    if (firstSlab > lastSlab) return {};
+
+    std::vector<CoordinateArrays> slabRings(lastSlab - firstSlab + 1);
+    auto append = [&](int64_t slab, double coordinate, double otherCoordinate)
+    {
+        if (slab < firstSlab || slab > lastSlab) return;
+
+        double x = isAlongX ? coordinate : otherCoordinate;
+        double y = isAlongX ? otherCoordinate : coordinate;
+        auto& slabRing = slabRings[slab - firstSlab];
+        if (slabRing.size() > 0 && slabRing.xs.back() == x && slabRing.ys.back() == y) return;
+        slabRing.push_back(x, y);
+    };
+
+    for (size_t i = 0; i < size; ++i)
+    {
+        size_t next = i + 1 < size ? i + 1 : 0;
+        append(slabs[i], coordinates[i], otherCoordinates[i]);
+
+        int64_t step = slabs[next] > slabs[i] ? 1 : -1;
+        for (int64_t slab = slabs[i]; slab != slabs[next]; slab += step)
+        {
+            // Boundary between slab and slab + step.
+            double boundary = origin + static_cast<double>(step > 0 ? slab + 1 : slab) * slabSize;
+            double t = (boundary - coordinates[i]) / (coordinates[next] - coordinates[i]);
+            double otherCoordinate = otherCoordinates[i] + t * (otherCoordinates[next] - otherCoordinates[i]);
+            append(slab, boundary, otherCoordinate);
+            append(slab + step, boundary, otherCoordinate);
+        }
+    }
+
+    std::vector<Slab> result;
+    for (size_t k = 0; k < slabRings.size(); ++k)
+    {
+        removeRepeatedVertices(slabRings[k]);
+        if (slabRings[k].size() == 0) continue;
+
+        result.push_back({static_cast<size_t>(firstSlab) + k, std::move(slabRings[k])});
+    }
+    return result;
+}
+
+// The arrays never overlap, which the compiler needs to know to vectorise the loops. The segments are processed
+// in blocks, so that the visibility flags are narrowed to bytes in a loop of their own. GCC does not vectorise
+// that narrowing together with the arithmetic on doubles.
+void clipLineSegmentsKernel(size_t size,
+                            const double* __restrict startXs,
+                            const double* __restrict startYs,
+                            const double* __restrict endXs,
+                            const double* __restrict endYs,
+                            double minX,
+                            double minY,
+                            double maxX,
+                            double maxY,
+                            double* __restrict clippedStartXs,
+                            double* __restrict clippedStartYs,
+                            double* __restrict clippedEndXs,
+                            double* __restrict clippedEndYs,
+                            uint8_t* __restrict isVisible)
+{
+    constexpr size_t blockSize = 256;
+    double visibleLengths[blockSize];
+    for (size_t blockBegin = 0; blockBegin < size; blockBegin += blockSize)
+    {
+        size_t blockEnd = std::min(blockBegin + blockSize, size);
+        for (size_t i = blockBegin; i < blockEnd; ++i)
+        {
+            double enter, exit;
+            getClipParameters(startXs[i], startYs[i], endXs[i], endYs[i], minX, minY, maxX, maxY, enter, exit);
+            double deltaX = endXs[i] - startXs[i];
+            double deltaY = endYs[i] - startYs[i];
+            clippedStartXs[i] = startXs[i] + enter * deltaX;
+            clippedStartYs[i] = startYs[i] + enter * deltaY;
+            clippedEndXs[i] = startXs[i] + exit * deltaX;
+            clippedEndYs[i] = startYs[i] + exit * deltaY;
+            visibleLengths[i - blockBegin] = exit - enter;
+        }
+        for (size_t i = blockBegin; i < blockEnd; ++i)
+        {
+            isVisible[i] = visibleLengths[i - blockBegin] >= 0.;
+        }
+    }
+}
+
+} // namespace
+
+void clipLineSegments(const LineSegmentArrays& lineSegments,
+                      const ClipRectangle& rectangle,
+                      LineSegmentArrays& clippedOut,
+                      std::vector<uint8_t>& isVisibleOut)
+{
+    size_t size = lineSegments.size();
+    clippedOut.startXs.resize(size);
+    clippedOut.startYs.resize(size);
+    clippedOut.endXs.resize(size);
+    clippedOut.endYs.resize(size);
+    isVisibleOut.resize(size);
+
+    clipLineSegmentsKernel(size, lineSegments.startXs.data(), lineSegments.startYs.data(), lineSegments.endXs.data(),
+                           lineSegments.endYs.data(), rectangle.minX, rectangle.minY, rectangle.maxX,
+                           rectangle.maxY, clippedOut.startXs.data(), clippedOut.startYs.data(),
+                           clippedOut.endXs.data(), clippedOut.endYs.data(), isVisibleOut.data());
+}
+
+std::optional<primitives::LineSegment> clipLineSegment(const primitives::LineSegment& lineSegment, const ClipRectangle& rectangle)
+{
+    auto start = lineSegment.getStartPoint();
+    auto end = lineSegment.getEndPoint();
+    double enter, exit;
+    getClipParameters(start.x(), start.y(), end.x(), end.y(), rectangle.minX, rectangle.minY, rectangle.maxX,
+                      rectangle.maxY, enter, exit);
+    if (enter > exit)
+    {
+        return std::nullopt;
+    }
+
+    primitives::Point clippedStart(start.x() + enter * (end.x() - start.x()), start.y() + enter * (end.y() - start.y()));
+    primitives::Point clippedEnd(start.x() + exit * (end.x() - start.x()), start.y() + exit * (end.y() - start.y()));
+    // Same threshold as in the LineSegment constructor.
+    if (clippedStart.squareDistance(clippedEnd) < 1e-6)
+    {
+        return std::nullopt;
+    }
+    return primitives::LineSegment(clippedStart, clippedEnd);
+}
+
+CoordinateArrays clipRing(const CoordinateArrays& ring, const ClipRectangle& rectangle)
+{
+    auto result = clipToHalfPlane(ring, true, rectangle.minX, true);
+    result = clipToHalfPlane(result, true, rectangle.maxX, false);
+    result = clipToHalfPlane(result, false, rectangle.minY, true);
+    result = clipToHalfPlane(result, false, rectangle.maxY, false);
+    removeRepeatedVertices(result);
+    return result;
+}
+
+CoordinateArrays clipRing(const primitives::Polygon& polygon, const ClipRectangle& rectangle)
+{
+    return clipRing(toCoordinateArrays(polygon), rectangle);
+}
+
+std::vector<ClippedTile> clipRingToTiles(const CoordinateArrays& ring, const TileGrid& grid)
+{
+    std::vector<ClippedTile> tiles;
+    for (auto& column : splitIntoSlabs(ring, true, grid.originX, grid.tileSize, grid.numTilesX))
+    {
+        for (auto& row : splitIntoSlabs(column.ring, false, grid.originY, grid.tileSize, grid.numTilesY))
+        {
+            tiles.push_back({column.index, row.index, std::move(row.ring)});
+        }
+    }
+    return tiles;
+}
+
+std::vector<ClippedTile> clipRingToTiles(const primitives::Polygon& polygon, const TileGrid& grid)
+{
+    return clipRingToTiles(toCoordinateArrays(polygon), grid);
+}
+
+} // namespace algorithms
@@ -0,0 +1,95 @@
+#ifndef RECTCLIP_HPP_INCLUDED
+#define RECTCLIP_HPP_INCLUDED
+
+#include <cstdint>
+#include <optional>
+#include <vector>
+
+#include "primitives/linesegment.hpp"
+#include "primitives/polygon.hpp"
+
+namespace algorithms
+{
+
+// Axis-aligned rectangle, including its boundary.
+struct ClipRectangle
+{
+    double minX;
+    double minY;
+    double maxX;
+    double maxY;
+};
+
+// Vertices of a ring or a polyline in structure-of-arrays layout.
+struct CoordinateArrays
+{
+    size_t size() const { return xs.size(); }
+    void push_back(double x, double y)
+    {
+        xs.push_back(x);
+        ys.push_back(y);
+    }
+
+    std::vector<double> xs;
+    std::vector<double> ys;
+};
+
+// Line segment i goes from (startXs[i], startYs[i]) to (endXs[i], endYs[i]).
+struct LineSegmentArrays
+{
+    size_t size() const { return startXs.size(); }
+
+    std::vector<double> startXs;
+    std::vector<double> startYs;
+    std::vector<double> endXs;
+    std::vector<double> endYs;
+};
+
+// Liang-Barsky clipping of every line segment against <rectangle>. Afterwards isVisibleOut[i] tells whether line
+// segment i touches the rectangle, and if so, clippedOut holds its part inside at index i. Other entries of
+// clippedOut are unspecified. This runs a loop without branches over the arrays, which GCC and Clang only turn
+// into SIMD code at -O3, as in the Release builds the top-level CMakeLists.txt defaults to.
+void clipLineSegments(const LineSegmentArrays& lineSegments,
+                      const ClipRectangle& rectangle,
+                      LineSegmentArrays& clippedOut,
+                      std::vector<uint8_t>& isVisibleOut);
+
+// Single line segment version of the above. Returns std::nullopt if the part inside the rectangle is too short
+// to be a LineSegment.
+std::optional<primitives::LineSegment> clipLineSegment(const primitives::LineSegment& lineSegment, const ClipRectangle& rectangle);
+
+// Sutherland-Hodgman clipping of a closed ring against <rectangle>. The result keeps the orientation of the ring
+// and is empty if the ring lies outside. As usual for this algorithm, a concave ring leaving and reentering the
+// rectangle gives a single ring, connected by edges along the rectangle boundary.
+CoordinateArrays clipRing(const CoordinateArrays& ring, const ClipRectangle& rectangle);
+CoordinateArrays clipRing(const primitives::Polygon& polygon, const ClipRectangle& rectangle);
+
+// Square tiles of size tileSize, where tile (x, y) covers [originX + x * tileSize, originX + (x + 1) * tileSize]
+// times [originY + y * tileSize, originY + (y + 1) * tileSize].
+struct TileGrid
+{
+    double originX;
+    double originY;
+    double tileSize;
+    size_t numTilesX;
+    size_t numTilesY;
+};
+
+struct ClippedTile
+{
+    size_t tileX;
+    size_t tileY;
+    CoordinateArrays ring;
+};
+
+// Clips a ring to every tile of <grid> it covers part of, with the same result per tile as clipRing. Instead of
+// clipping once per tile, the ring is first split into the columns of the grid in a single pass over its edges,
+// handing the crossing points with each column boundary to the columns on both sides, and then every column is
+// split into its rows the same way. Only the columns and rows between the ring's extreme vertices are visited,
+// so this takes time linear in the size of the ring plus the output, regardless of the size of the grid.
+std::vector<ClippedTile> clipRingToTiles(const CoordinateArrays& ring, const TileGrid& grid);
+std::vector<ClippedTile> clipRingToTiles(const primitives::Polygon& polygon, const TileGrid& grid);
+
+} // namespace algorithms
+
+#endif
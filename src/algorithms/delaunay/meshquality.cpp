@@ -0,0 +1,171 @@
+#include "meshquality.hpp"
+#include "utility/parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+
+namespace algorithms
+{
+
+namespace
+{
+
+// Running min/max/sum of the per triangle measures, one per thread.
+struct PartialStats
+{
+    double minAngle = std::numeric_limits<double>::max();
+    double maxAngle = 0;
+    double minAspectRatio = std::numeric_limits<double>::max();
+    double maxAspectRatio = 0;
+    double sumAspectRatio = 0;
+    double minRadiusEdgeRatio = std::numeric_limits<double>::max();
+    double maxRadiusEdgeRatio = 0;
+    double sumRadiusEdgeRatio = 0;
+    double minArea = std::numeric_limits<double>::max();
+    double maxArea = 0;
+    double sumArea = 0;
+
+    void merge(const PartialStats& other)
+    {
+        minAngle = std::min(minAngle, other.minAngle);
+        maxAngle = std::max(maxAngle, other.maxAngle);
+        minAspectRatio = std::min(minAspectRatio, other.minAspectRatio);
+        maxAspectRatio = std::max(maxAspectRatio, other.maxAspectRatio);
+        sumAspectRatio += other.sumAspectRatio;
+        minRadiusEdgeRatio = std::min(minRadiusEdgeRatio, other.minRadiusEdgeRatio);
+        maxRadiusEdgeRatio = std::max(maxRadiusEdgeRatio, other.maxRadiusEdgeRatio);
+        sumRadiusEdgeRatio += other.sumRadiusEdgeRatio;
+        minArea = std::min(minArea, other.minArea);
+        maxArea = std::max(maxArea, other.maxArea);
+        sumArea += other.sumArea;
+    }
+};
+
+} // namespace
+
+MeshQualityStats computeMeshQuality(const TriangulationTopology& topology, size_t numAreaBins, size_t numThreads)
+{
+    const auto& vertices = topology.getTriangulation().vertices;
+    size_t numTriangles = topology.getNumTriangles();
+    size_t numChunks = std::min(utility::getNumThreads(numThreads), std::max<size_t>(1, numTriangles));
+
+    // First pass: per triangle measures. The areas are kept for the histogram, whose range is only known afterwards.
+    std::vector<double> areas(numTriangles);
+    std::vector<PartialStats> partials(numChunks);
+    utility::parallelForChunks(numTriangles, numChunks, [&](size_t begin, size_t end, size_t chunkIdx)
+    {
+        auto& partial = partials[chunkIdx];
+        for (size_t t = begin; t < end; ++t)
+        {
+            double squareEdgeLengths[3];
+            double edgeLengths[3];
+            double angles[3];
+            double twiceArea = 0;
+            for (size_t k = 0; k < 3; ++k)
+            {
+                const auto& corner = vertices[topology.getCorner(t, k)];
+                const auto& next = vertices[topology.getCorner(t, (k + 1) % 3)];
+                const auto& previous = vertices[topology.getCorner(t, (k + 2) % 3)];
+                double toNextX = next.x() - corner.x(), toNextY = next.y() - corner.y();
+                double toPreviousX = previous.x() - corner.x(), toPreviousY = previous.y() - corner.y();
+                double cross = toNextX * toPreviousY - toNextY * toPreviousX;
+
+                squareEdgeLengths[k] = toNextX * toNextX + toNextY * toNextY;
+                edgeLengths[k] = std::sqrt(squareEdgeLengths[k]);
+                angles[k] = std::atan2(std::abs(cross), toNextX * toPreviousX + toNextY * toPreviousY);
+                twiceArea = cross;
+            }
+
+            double area = .5 * std::abs(twiceArea);
+            double longestSquareEdge = *std::max_element(squareEdgeLengths, squareEdgeLengths + 3);
+            double shortestEdge = *std::min_element(edgeLengths, edgeLengths + 3);
+            double aspectRatio = std::sqrt(3.) * longestSquareEdge / (4 * area);
+            double circumradius = edgeLengths[0] * edgeLengths[1] * edgeLengths[2] / (4 * area);
+            double radiusEdgeRatio = circumradius / shortestEdge;
+
+            areas[t] = area;
+            partial.minAngle = std::min({partial.minAngle, angles[0], angles[1], angles[2]});
+            partial.maxAngle = std::max({partial.maxAngle, angles[0], angles[1], angles[2]});
+            partial.minAspectRatio = std::min(partial.minAspectRatio, aspectRatio);
+            partial.maxAspectRatio = std::max(partial.maxAspectRatio, aspectRatio);
+            partial.sumAspectRatio += aspectRatio;
+            partial.minRadiusEdgeRatio = std::min(partial.minRadiusEdgeRatio, radiusEdgeRatio);
+            partial.maxRadiusEdgeRatio = std::max(partial.maxRadiusEdgeRatio, radiusEdgeRatio);
+            partial.sumRadiusEdgeRatio += radiusEdgeRatio;
+            partial.minArea = std::min(partial.minArea, area);
+            partial.maxArea = std::max(partial.maxArea, area);
+            partial.sumArea += area;
+        }
+    });
+
+    PartialStats total;
+    for (const auto& partial : partials)
+    {
+        total.merge(partial);
+    }
+
+    MeshQualityStats stats;
+    stats.numTriangles = numTriangles;
+    if (numTriangles > 0)
+    {
+        stats.minAngle = total.minAngle;
+        stats.maxAngle = total.maxAngle;
+        stats.minAspectRatio = total.minAspectRatio;
+        stats.maxAspectRatio = total.maxAspectRatio;
+        stats.meanAspectRatio = total.sumAspectRatio / numTriangles;
+        stats.minRadiusEdgeRatio = total.minRadiusEdgeRatio;
+        stats.maxRadiusEdgeRatio = total.maxRadiusEdgeRatio;
+        stats.meanRadiusEdgeRatio = total.sumRadiusEdgeRatio / numTriangles;
+        stats.minArea = total.minArea;
+        stats.maxArea = total.maxArea;
+        stats.totalArea = total.sumArea;
+    }
+
+    // Second pass: area histogram, with one histogram per thread which are summed afterwards.
+    numAreaBins = std::max<size_t>(1, numAreaBins);
+    std::vector<std::vector<size_t>> partialHistograms(numChunks, std::vector<size_t>(numAreaBins, 0));
+    double binWidth = (stats.maxArea - stats.minArea) / numAreaBins;
+    utility::parallelForChunks(numTriangles, numChunks, [&](size_t begin, size_t end, size_t chunkIdx)
+    {
+        for (size_t t = begin; t < end; ++t)
+        {
+            size_t bin = binWidth > 0 ? static_cast<size_t>((areas[t] - stats.minArea) / binWidth) : 0;
+            ++partialHistograms[chunkIdx][std::min(bin, numAreaBins - 1)];
+        }
+    });
+    stats.areaHistogram.assign(numAreaBins, 0);
+    for (const auto& histogram : partialHistograms)
+    {
+        for (size_t bin = 0; bin < numAreaBins; ++bin)
+        {
+            stats.areaHistogram[bin] += histogram[bin];
+        }
+    }
+
+    // Third pass: vertex degrees, walking the one-ring of every vertex.
+    size_t numVertexChunks = std::min(utility::getNumThreads(numThreads), std::max<size_t>(1, vertices.size()));
+    std::vector<std::vector<size_t>> partialDegreeHistograms(numVertexChunks);
+    utility::parallelForChunks(vertices.size(), numVertexChunks, [&](size_t begin, size_t end, size_t chunkIdx)
+    {
+        auto& histogram = partialDegreeHistograms[chunkIdx];
+        for (size_t v = begin; v < end; ++v)
+        {
+            auto degree = static_cast<size_t>(std::ranges::distance(topology.getVertexRing(v)));
+            if (histogram.size() <= degree) histogram.resize(degree + 1, 0);
+            ++histogram[degree];
+        }
+    });
+    for (const auto& histogram : partialDegreeHistograms)
+    {
+        if (stats.degreeHistogram.size() < histogram.size()) stats.degreeHistogram.resize(histogram.size(), 0);
+        for (size_t degree = 0; degree < histogram.size(); ++degree)
+        {
+            stats.degreeHistogram[degree] += histogram[degree];
+        }
+    }
+
+    return stats;
+}
+
+} // namespace algorithms
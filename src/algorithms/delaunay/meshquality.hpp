@@ -0,0 +1,46 @@
+#ifndef ALGORITHMS_DELAUNAY_MESHQUALITY_HPP_INCLUDED
+#define ALGORITHMS_DELAUNAY_MESHQUALITY_HPP_INCLUDED
+
+#include "topology.hpp"
+
+#include <vector>
+
+namespace algorithms
+{
+
+/// @brief Summary of the shape quality of the triangles of a mesh. Angles are in radians.
+///        The aspect ratio of a triangle is its longest edge divided by its shortest altitude, scaled such that
+///        an equilateral triangle has aspect ratio 1. The radius-edge ratio is the circumradius divided by the
+///        shortest edge, which is 1/sqrt(3) for an equilateral triangle.
+struct MeshQualityStats
+{
+    size_t numTriangles = 0;
+
+    double minAngle = 0;
+    double maxAngle = 0;
+
+    double minAspectRatio = 0;
+    double maxAspectRatio = 0;
+    double meanAspectRatio = 0;
+
+    double minRadiusEdgeRatio = 0;
+    double maxRadiusEdgeRatio = 0;
+    double meanRadiusEdgeRatio = 0;
+
+    double minArea = 0;
+    double maxArea = 0;
+    double totalArea = 0;
+    /// @brief Number of triangles per area bin, where the bins evenly divide [minArea, maxArea].
+    std::vector<size_t> areaHistogram;
+
+    /// @brief degreeHistogram[d] is the number of vertices with exactly d neighbours.
+    std::vector<size_t> degreeHistogram;
+};
+
+/// @brief Computes the quality statistics in parallel passes over the triangles and vertices,
+///        split over <numThreads> threads (0 meaning all hardware threads).
+MeshQualityStats computeMeshQuality(const TriangulationTopology& topology, size_t numAreaBins = 16, size_t numThreads = 0);
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_DELAUNAY_MESHQUALITY_HPP_INCLUDED
@@ -0,0 +1,68 @@
+#include "powerdiagram.hpp"
+#include "topology.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace algorithms
+{
+
+primitives::Point getPowerCenter(const primitives::Point& p1, double w1,
+                                 const primitives::Point& p2, double w2,
+                                 const primitives::Point& p3, double w3)
+{
+    // The power center c satisfies |c - p_i|^2 - w_i = |c - p_1|^2 - w_1, which is linear in c:
+    // 2 (p_i - p_1) . c = |p_i|^2 - w_i - |p_1|^2 + w_1 for i = 2, 3.
+    double a11 = 2 * (p2.x() - p1.x());
+    double a12 = 2 * (p2.y() - p1.y());
+    double a21 = 2 * (p3.x() - p1.x());
+    double a22 = 2 * (p3.y() - p1.y());
+    double b1 = p2.squareNorm() - w2 - p1.squareNorm() + w1;
+    double b2 = p3.squareNorm() - w3 - p1.squareNorm() + w1;
+
+    double determinant = a11 * a22 - a12 * a21;
+    if (std::abs(determinant) < 1e-12)
+    {
+        throw std::runtime_error("Cannot compute power center of collinear points.");
+    }
+
+    return primitives::Point((b1 * a22 - a12 * b2) / determinant, (a11 * b2 - b1 * a21) / determinant);
+}
+
+PowerDiagram computePowerDiagram(const DelaunayTriangulator& triangulator)
+{
+    TriangulationTopology topology(triangulator.getTriangulation());
+    const auto& triangulation = topology.getTriangulation();
+    auto weight = [&triangulator](size_t vIdx) { return triangulator.isWeighted() ? triangulator.getWeights()[vIdx] : 0.; };
+
+    PowerDiagram diagram;
+    diagram.vertices.reserve(topology.getNumTriangles());
+    for (size_t t = 0; t < topology.getNumTriangles(); ++t)
+    {
+        size_t v1 = topology.getCorner(t, 0);
+        size_t v2 = topology.getCorner(t, 1);
+        size_t v3 = topology.getCorner(t, 2);
+        diagram.vertices.push_back(getPowerCenter(triangulation.vertices[v1], weight(v1),
+                                                  triangulation.vertices[v2], weight(v2),
+                                                  triangulation.vertices[v3], weight(v3)));
+    }
+
+    // The cell of a site has one vertex per incident triangle, in the same counter-clockwise order.
+    diagram.cellOffsets.reserve(triangulation.vertices.size() + 1);
+    diagram.cellOffsets.push_back(0);
+    diagram.isCellBounded.reserve(triangulation.vertices.size());
+    for (size_t v = 0; v < triangulation.vertices.size(); ++v)
+    {
+        for (auto t : topology.getIncidentTriangles(v))
+        {
+            diagram.cellIndices.push_back(t);
+        }
+        diagram.cellOffsets.push_back(diagram.cellIndices.size());
+        // Redundant sites have no triangles, and so their (empty) cell counts as bounded.
+        diagram.isCellBounded.push_back(topology.getIncidentTriangle(v) == NoTriangle || !topology.isBoundaryVertex(v));
+    }
+
+    return diagram;
+}
+
+} // namespace algorithms
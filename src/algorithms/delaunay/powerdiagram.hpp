@@ -0,0 +1,41 @@
+#ifndef ALGORITHMS_DELAUNAY_POWERDIAGRAM_HPP_INCLUDED
+#define ALGORITHMS_DELAUNAY_POWERDIAGRAM_HPP_INCLUDED
+
+#include "primitives/point.hpp"
+#include "triangulation.hpp"
+
+#include <vector>
+
+namespace algorithms
+{
+
+/// @brief The power diagram (weighted Voronoi diagram) of a set of weighted sites, stored in flat arrays.
+///        The cell of site i is the region of points p for which |p - site_i|^2 - w_i is smallest.
+///        Its vertices are cellIndices[cellOffsets[i]], ..., cellIndices[cellOffsets[i + 1] - 1], given in
+///        counter-clockwise order as indices into <vertices>.
+///        Cells of sites on the boundary of the triangulation are unbounded. Their vertices form an open chain,
+///        and the two unbounded edges leave the first resp. last vertex perpendicular to the adjacent boundary edges.
+///        Sites whose weight is so small that no point is closer to them than to the other sites (redundant sites)
+///        are not part of the regular triangulation, and get empty cells.
+struct PowerDiagram
+{
+    /// @brief One vertex (power center) per triangle of the underlying regular triangulation.
+    std::vector<primitives::Point> vertices;
+    std::vector<size_t> cellOffsets;
+    std::vector<size_t> cellIndices;
+    std::vector<bool> isCellBounded;
+};
+
+/// @brief Computes the point which has equal power distance to the three weighted points. For zero weights
+///        this is just the circumcenter.
+primitives::Point getPowerCenter(const primitives::Point& p1, double w1,
+                                 const primitives::Point& p2, double w2,
+                                 const primitives::Point& p3, double w3);
+
+/// @brief Extracts the power diagram as the dual of an already performed (weighted) triangulation.
+///        For unweighted triangulations all weights are taken to be zero, i. e., this yields the Voronoi diagram.
+PowerDiagram computePowerDiagram(const DelaunayTriangulator& triangulator);
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_DELAUNAY_POWERDIAGRAM_HPP_INCLUDED
@@ -0,0 +1,300 @@
+#include "spanningtree.hpp"
+#include "utility/disjointsets.hpp"
+#include "utility/parallel.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <numeric>
+#include <tuple>
+
+namespace algorithms
+{
+
+namespace
+{
+
+// Every undirected Delaunay edge once, smallest vertex index first.
+std::vector<Edge> getUndirectedEdges(const DelaunayTriangulator& triangulator)
+{
+    std::vector<Edge> edges;
+    edges.reserve(triangulator.getEdges().size() / 2);
+    for (const auto& [v1, v2] : triangulator.getEdges())
+    {
+        if (v1 < v2) edges.push_back({v1, v2});
+    }
+    return edges;
+}
+
+double getSquareLength(const DelaunayTriangulator& triangulator, const Edge& edge)
+{
+    return triangulator.getVertices()[edge.first].squareDistance(triangulator.getVertices()[edge.second]);
+}
+
+// Sorts edges by length, breaking ties by vertex indices so that all algorithms agree on one and the same tree.
+void sortByLength(const DelaunayTriangulator& triangulator, std::vector<Edge>& edges)
+{
+    std::vector<double> squareLengths(edges.size());
+    for (size_t e = 0; e < edges.size(); ++e)
+    {
+        squareLengths[e] = getSquareLength(triangulator, edges[e]);
+    }
+
+    std::vector<size_t> order(edges.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&edges, &squareLengths](size_t lhs, size_t rhs)
+    {
+        return std::tie(squareLengths[lhs], edges[lhs]) < std::tie(squareLengths[rhs], edges[rhs]);
+    });
+
+    std::vector<Edge> sortedEdges;
+    sortedEdges.reserve(edges.size());
+    for (auto e : order)
+    {
+        sortedEdges.push_back(edges[e]);
+    }
+    edges = std::move(sortedEdges);
+}
+
+} // namespace
+
+std::vector<Edge> computeMinimumSpanningTree(const DelaunayTriangulator& triangulator)
+{
+    auto edges = getUndirectedEdges(triangulator);
+    sortByLength(triangulator, edges);
+
+    utility::DisjointSets components(triangulator.getVertices().size());
+    std::vector<Edge> tree;
+    for (const auto& edge : edges)
+    {
+        if (components.unite(edge.first, edge.second))
+        {
+            tree.push_back(edge);
+        }
+    }
+
+    return tree;
+}
+
+std::vector<Edge> computeMinimumSpanningTreeParallel(const DelaunayTriangulator& triangulator, size_t numThreads)
+{
+    auto edges = getUndirectedEdges(triangulator);
+    size_t numVertices = triangulator.getVertices().size();
+    size_t numChunks = std::min(utility::getNumThreads(numThreads), std::max<size_t>(1, numVertices));
+
+    std::vector<double> squareLengths(edges.size());
+    utility::parallelForChunks(edges.size(), numChunks, [&](size_t begin, size_t end, size_t)
+    {
+        for (size_t e = begin; e < end; ++e)
+        {
+            squareLengths[e] = getSquareLength(triangulator, edges[e]);
+        }
+    });
+
+    // Breaking ties by vertex indices, as in sortByLength, makes the order of the edges strict, which is what
+    // keeps Borůvka from creating cycles, and gives the same tree as Kruskal.
+    constexpr size_t NoEdge = std::numeric_limits<size_t>::max();
+    auto isCheaper = [&edges, &squareLengths](size_t e1, size_t e2)
+    {
+        return e2 == NoEdge || (e1 != NoEdge && std::tie(squareLengths[e1], edges[e1]) < std::tie(squareLengths[e2], edges[e2]));
+    };
+
+    // Every round works on the components left by the previous one, numbered densely, and only on the edges
+    // between different components. The end points of remainingEdges[i] are in the components edgeComponents[i].
+    size_t numComponents = numVertices;
+    std::vector<size_t> remainingEdges(edges.size());
+    std::iota(remainingEdges.begin(), remainingEdges.end(), 0);
+    std::vector<Edge> edgeComponents = edges;
+    auto isCheaperPosition = [&](size_t i1, size_t i2)
+    {
+        return i2 == NoEdge || (i1 != NoEdge && isCheaper(remainingEdges[i1], remainingEdges[i2]));
+    };
+
+    std::vector<size_t> chunkCheapestPositions;
+    std::vector<size_t> cheapestPositions;
+    std::vector<size_t> parents;
+    std::vector<size_t> nextParents;
+    std::vector<size_t> newComponents;
+    std::vector<size_t> chunkCounts(numChunks + 1);
+    std::vector<std::vector<Edge>> chunkTreeEdges(numChunks);
+
+    while (!remainingEdges.empty())
+    {
+        // Cheapest edge per component, first within each chunk of edges and then merged over the chunks, so that
+        // no two threads write to the same entry. Edges are referred to by their position in remainingEdges.
+        chunkCheapestPositions.resize(numChunks * numComponents);
+        utility::parallelForChunks(remainingEdges.size(), numChunks, [&](size_t begin, size_t end, size_t chunk)
+        {
+            size_t* cheapest = chunkCheapestPositions.data() + chunk * numComponents;
+            std::fill(cheapest, cheapest + numComponents, NoEdge);
+            for (size_t i = begin; i < end; ++i)
+            {
+                const auto& [component1, component2] = edgeComponents[i];
+                if (isCheaperPosition(i, cheapest[component1])) cheapest[component1] = i;
+                if (isCheaperPosition(i, cheapest[component2])) cheapest[component2] = i;
+            }
+        });
+        cheapestPositions.resize(numComponents);
+        utility::parallelForChunks(numComponents, numChunks, [&](size_t begin, size_t end, size_t)
+        {
+            for (size_t c = begin; c < end; ++c)
+            {
+                cheapestPositions[c] = NoEdge;
+                for (size_t chunk = 0; chunk < numChunks; ++chunk)
+                {
+                    size_t i = chunkCheapestPositions[chunk * numComponents + c];
+                    if (isCheaperPosition(i, cheapestPositions[c])) cheapestPositions[c] = i;
+                }
+            }
+        });
+
+        // Every component is hooked onto the component at the other end of its cheapest edge. As the order of the
+        // edges is strict, this forms trees, except that two components may choose the same edge. The smaller one
+        // of them becomes the root, and every other component contributes its edge to the spanning tree.
+        parents.resize(numComponents);
+        utility::parallelForChunks(numComponents, numChunks, [&](size_t begin, size_t end, size_t chunk)
+        {
+            for (size_t c = begin; c < end; ++c)
+            {
+                size_t i = cheapestPositions[c];
+                parents[c] = c;
+                if (i == NoEdge) continue;
+
+                size_t other = edgeComponents[i].first == c ? edgeComponents[i].second : edgeComponents[i].first;
+                if (cheapestPositions[other] == i && c < other) continue;
+
+                parents[c] = other;
+                chunkTreeEdges[chunk].push_back(edges[remainingEdges[i]]);
+            }
+        });
+
+        // Pointer jumping, until every component points to the root of its tree.
+        nextParents.resize(numComponents);
+        bool hasChanged = true;
+        while (hasChanged)
+        {
+            std::fill(chunkCounts.begin(), chunkCounts.end(), 0);
+            utility::parallelForChunks(numComponents, numChunks, [&](size_t begin, size_t end, size_t chunk)
+            {
+                for (size_t c = begin; c < end; ++c)
+                {
+                    nextParents[c] = parents[parents[c]];
+                    chunkCounts[chunk] += nextParents[c] != parents[c];
+                }
+            });
+            std::swap(parents, nextParents);
+            hasChanged = std::any_of(chunkCounts.begin(), chunkCounts.end(), [](size_t count) { return count > 0; });
+        }
+
+        // The roots are numbered densely in their order, using the number of roots in the chunks before.
+        newComponents.resize(numComponents);
+        std::fill(chunkCounts.begin(), chunkCounts.end(), 0);
+        utility::parallelForChunks(numComponents, numChunks, [&](size_t begin, size_t end, size_t chunk)
+        {
+            for (size_t c = begin; c < end; ++c)
+            {
+                chunkCounts[chunk + 1] += parents[c] == c;
+            }
+        });
+        std::partial_sum(chunkCounts.begin(), chunkCounts.end(), chunkCounts.begin());
+        utility::parallelForChunks(numComponents, numChunks, [&](size_t begin, size_t end, size_t chunk)
+        {
+            size_t nextComponent = chunkCounts[chunk];
+            for (size_t c = begin; c < end; ++c)
+            {
+                if (parents[c] == c) newComponents[c] = nextComponent++;
+            }
+        });
+        numComponents = chunkCounts.back();
+
+        // Edges which now lie within a component are dropped. The others are compacted in the same way as the roots.
+        auto getNewComponents = [&](size_t i)
+        {
+            return Edge{newComponents[parents[edgeComponents[i].first]], newComponents[parents[edgeComponents[i].second]]};
+        };
+        std::fill(chunkCounts.begin(), chunkCounts.end(), 0);
+        utility::parallelForChunks(remainingEdges.size(), numChunks, [&](size_t begin, size_t end, size_t chunk)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                auto [component1, component2] = getNewComponents(i);
+                chunkCounts[chunk + 1] += component1 != component2;
+            }
+        });
+        std::partial_sum(chunkCounts.begin(), chunkCounts.end(), chunkCounts.begin());
+        std::vector<size_t> nextRemainingEdges(chunkCounts.back());
+        std::vector<Edge> nextEdgeComponents(chunkCounts.back());
+        utility::parallelForChunks(remainingEdges.size(), numChunks, [&](size_t begin, size_t end, size_t chunk)
+        {
+            size_t nextPosition = chunkCounts[chunk];
+            for (size_t i = begin; i < end; ++i)
+            {
+                auto newEdgeComponents = getNewComponents(i);
+                if (newEdgeComponents.first == newEdgeComponents.second) continue;
+
+                nextRemainingEdges[nextPosition] = remainingEdges[i];
+                nextEdgeComponents[nextPosition] = newEdgeComponents;
+                ++nextPosition;
+            }
+        });
+        remainingEdges = std::move(nextRemainingEdges);
+        edgeComponents = std::move(nextEdgeComponents);
+    }
+
+    std::vector<Edge> tree;
+    for (const auto& edgesOfChunk : chunkTreeEdges)
+    {
+        tree.insert(tree.end(), edgesOfChunk.begin(), edgesOfChunk.end());
+    }
+
+    // Only the tree edges are sorted, for the same order as Kruskal.
+    sortByLength(triangulator, tree);
+
+    return tree;
+}
+
+std::vector<size_t> computeNearestNeighbours(const DelaunayTriangulator& triangulator, size_t numThreads)
+{
+    size_t numVertices = triangulator.getVertices().size();
+    std::vector<size_t> nearestNeighbours(numVertices);
+    std::iota(nearestNeighbours.begin(), nearestNeighbours.end(), 0);
+
+    size_t numChunks = std::min(utility::getNumThreads(numThreads), std::max<size_t>(1, numVertices));
+    utility::parallelForChunks(numVertices, numChunks, [&](size_t begin, size_t end, size_t)
+    {
+        for (size_t v = begin; v < end; ++v)
+        {
+            double minSquareDistance = std::numeric_limits<double>::max();
+            auto [startIt, endIt] = triangulator.getEdges().equal_range(v);
+            for (auto it = startIt; it != endIt; ++it)
+            {
+                double squareDistance = getSquareLength(triangulator, *it);
+                if (squareDistance < minSquareDistance)
+                {
+                    minSquareDistance = squareDistance;
+                    nearestNeighbours[v] = it->second;
+                }
+            }
+        }
+    });
+
+    return nearestNeighbours;
+}
+
+std::optional<Edge> computeClosestPair(const DelaunayTriangulator& triangulator)
+{
+    std::optional<Edge> closestPair = std::nullopt;
+    double minSquareDistance = std::numeric_limits<double>::max();
+    for (const auto& edge : getUndirectedEdges(triangulator))
+    {
+        double squareDistance = getSquareLength(triangulator, edge);
+        if (squareDistance < minSquareDistance)
+        {
+            minSquareDistance = squareDistance;
+            closestPair = edge;
+        }
+    }
+
+    return closestPair;
+}
+
+} // namespace algorithms
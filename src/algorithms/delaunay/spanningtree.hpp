@@ -0,0 +1,35 @@
+#ifndef ALGORITHMS_DELAUNAY_SPANNINGTREE_HPP_INCLUDED
+#define ALGORITHMS_DELAUNAY_SPANNINGTREE_HPP_INCLUDED
+
+#include "triangulation.hpp"
+
+#include <optional>
+#include <vector>
+
+namespace algorithms
+{
+
+// The Euclidean minimum spanning tree, nearest neighbours and closest pair are all subgraphs of the Delaunay
+// triangulation, so all functions below only consider the edges of an already performed triangulation.
+
+/// @brief Computes the Euclidean minimum spanning tree using Kruskal's algorithm over the Delaunay edges.
+/// @return The edges of the tree (smallest vertex index first) sorted by increasing length, which is also
+///         the merge order of single-linkage clustering.
+std::vector<Edge> computeMinimumSpanningTree(const DelaunayTriangulator& triangulator);
+
+/// @brief As above, but using Borůvka's algorithm on <numThreads> threads (0 meaning all hardware threads).
+///        Every round finds the cheapest edge leaving each component, merges the components along them and
+///        contracts the graph, so that the next round only sees the new components and the edges between them.
+std::vector<Edge> computeMinimumSpanningTreeParallel(const DelaunayTriangulator& triangulator, size_t numThreads = 0);
+
+/// @brief Finds the nearest neighbour of every vertex among its Delaunay neighbours.
+/// @return The index of the nearest neighbour per vertex. Vertices without edges are their own nearest neighbour.
+std::vector<size_t> computeNearestNeighbours(const DelaunayTriangulator& triangulator, size_t numThreads = 0);
+
+/// @brief Finds the closest pair of vertices, which is the shortest Delaunay edge.
+/// @return The closest pair, or nullopt if the triangulation has no edges.
+std::optional<Edge> computeClosestPair(const DelaunayTriangulator& triangulator);
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_DELAUNAY_SPANNINGTREE_HPP_INCLUDED
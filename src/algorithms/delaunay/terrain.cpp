@@ -0,0 +1,291 @@
+#include "terrain.hpp"
+#include "utility/parallel.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+#include <functional>
+#include <limits>
+
+namespace algorithms
+{
+
+namespace
+{
+
+Triangulation triangulatePoints(const std::vector<primitives::Point>& points, size_t numElevations)
+{
+    if (points.size() != numElevations)
+    {
+        throw std::invalid_argument("Expected exactly one elevation per point.");
+    }
+
+    DelaunayTriangulator triangulator(points);
+    if (!triangulator.performTriangulation())
+    {
+        throw std::runtime_error("Failed to triangulate terrain.");
+    }
+
+    return triangulator.getTriangulation();
+}
+
+// A piece of a contour line crossing one triangle, from the point where it enters the triangle through
+// edge <fromEdge> to the point where it leaves it through <toEdge>.
+struct ContourSegment
+{
+    size_t fromEdge;
+    size_t toEdge;
+};
+
+// The contour lines at a single level, with polyline offsets relative to the level's own point buffer.
+struct LevelContours
+{
+    std::vector<primitives::Point> points;
+    std::vector<size_t> polylineOffsets;
+    std::vector<bool> isClosed;
+};
+
+LevelContours chainContourSegments(std::vector<ContourSegment>& segments, const std::function<primitives::Point(size_t)>& crossingPoint)
+{
+    LevelContours contours;
+
+    // Every crossed edge is entered by at most one segment and left by at most one segment,
+    // so after sorting by <fromEdge> the successor of a segment can be found by binary search.
+    std::sort(segments.begin(), segments.end(), [](const ContourSegment& lhs, const ContourSegment& rhs)
+    {
+        return lhs.fromEdge < rhs.fromEdge;
+    });
+    constexpr size_t NoSegment = std::numeric_limits<size_t>::max();
+    std::vector<size_t> successors(segments.size(), NoSegment);
+    std::vector<bool> hasPredecessor(segments.size(), false);
+    for (size_t s = 0; s < segments.size(); ++s)
+    {
+        auto successorIt = std::lower_bound(segments.begin(), segments.end(), segments[s].toEdge,
+                                            [](const ContourSegment& segment, size_t edge) { return segment.fromEdge < edge; });
+        if (successorIt != segments.end() && successorIt->fromEdge == segments[s].toEdge)
+        {
+            successors[s] = successorIt - segments.begin();
+            hasPredecessor[successors[s]] = true;
+        }
+    }
+
+    std::vector<bool> isVisited(segments.size(), false);
+    auto tracePolyline = [&](size_t startSegment, bool isClosed)
+    {
+        contours.polylineOffsets.push_back(contours.points.size());
+        contours.isClosed.push_back(isClosed);
+        contours.points.push_back(crossingPoint(segments[startSegment].fromEdge));
+        for (size_t s = startSegment; s != NoSegment && !isVisited[s]; s = successors[s])
+        {
+            isVisited[s] = true;
+            if (!isClosed || successors[s] != startSegment)
+            {
+                contours.points.push_back(crossingPoint(segments[s].toEdge));
+            }
+        }
+    };
+
+    // Open polylines start and end on the boundary of the triangulation. Everything left afterwards is closed.
+    for (size_t s = 0; s < segments.size(); ++s)
+    {
+        if (!hasPredecessor[s]) tracePolyline(s, false);
+    }
+    for (size_t s = 0; s < segments.size(); ++s)
+    {
+        if (!isVisited[s]) tracePolyline(s, true);
+    }
+    contours.polylineOffsets.push_back(contours.points.size());
+
+    return contours;
+}
+
+} // namespace
+
+TerrainTriangulation::TerrainTriangulation(std::vector<primitives::Point> points, std::vector<double> elevations)
+    : m_topology(triangulatePoints(points, elevations.size())), m_elevations(elevations)
+{
+    buildLocationGrid();
+}
+
+void TerrainTriangulation::buildLocationGrid()
+{
+    const auto& vertices = getTriangulation().vertices;
+    double minX = vertices[0].x(), maxX = vertices[0].x(), minY = vertices[0].y(), maxY = vertices[0].y();
+    for (const auto& vertex : vertices)
+    {
+        minX = std::min(minX, vertex.x());
+        maxX = std::max(maxX, vertex.x());
+        minY = std::min(minY, vertex.y());
+        maxY = std::max(maxY, vertex.y());
+    }
+
+    // Aim for roughly one triangle per cell.
+    size_t numTriangles = m_topology.getNumTriangles();
+    m_gridOrigin = primitives::Point(minX, minY);
+    m_cellSize = std::max(std::sqrt((maxX - minX) * (maxY - minY) / std::max<size_t>(1, numTriangles)), 1e-9);
+    m_gridWidth = static_cast<size_t>((maxX - minX) / m_cellSize) + 1;
+    m_gridHeight = static_cast<size_t>((maxY - minY) / m_cellSize) + 1;
+
+    auto forEachCoveredCell = [this, &vertices](size_t t, auto&& func)
+    {
+        const auto& firstCorner = vertices[m_topology.getCorner(t, 0)];
+        double triMinX = firstCorner.x(), triMaxX = triMinX, triMinY = firstCorner.y(), triMaxY = triMinY;
+        for (size_t k = 1; k < 3; ++k)
+        {
+            const auto& corner = vertices[m_topology.getCorner(t, k)];
+            triMinX = std::min(triMinX, corner.x());
+            triMaxX = std::max(triMaxX, corner.x());
+            triMinY = std::min(triMinY, corner.y());
+            triMaxY = std::max(triMaxY, corner.y());
+        }
+        size_t iMin = static_cast<size_t>((triMinX - m_gridOrigin.x()) / m_cellSize);
+        size_t iMax = std::min(m_gridWidth - 1, static_cast<size_t>((triMaxX - m_gridOrigin.x()) / m_cellSize));
+        size_t jMin = static_cast<size_t>((triMinY - m_gridOrigin.y()) / m_cellSize);
+        size_t jMax = std::min(m_gridHeight - 1, static_cast<size_t>((triMaxY - m_gridOrigin.y()) / m_cellSize));
+        for (size_t j = jMin; j <= jMax; ++j)
+        {
+            for (size_t i = iMin; i <= iMax; ++i)
+            {
+                func(j * m_gridWidth + i);
+            }
+        }
+    };
+
+    m_cellOffsets.assign(m_gridWidth * m_gridHeight + 1, 0);
+    for (size_t t = 0; t < numTriangles; ++t)
+    {
+        forEachCoveredCell(t, [this](size_t cell) { ++m_cellOffsets[cell + 1]; });
+    }
+    for (size_t cell = 0; cell < m_gridWidth * m_gridHeight; ++cell)
+    {
+        m_cellOffsets[cell + 1] += m_cellOffsets[cell];
+    }
+    m_cellTriangles.resize(m_cellOffsets.back());
+    std::vector<size_t> fillPositions(m_cellOffsets.begin(), m_cellOffsets.end() - 1);
+    for (size_t t = 0; t < numTriangles; ++t)
+    {
+        forEachCoveredCell(t, [this, t, &fillPositions](size_t cell) { m_cellTriangles[fillPositions[cell]++] = t; });
+    }
+}
+
+std::optional<double> TerrainTriangulation::getElevation(const primitives::Point& point) const
+{
+    double cellX = (point.x() - m_gridOrigin.x()) / m_cellSize;
+    double cellY = (point.y() - m_gridOrigin.y()) / m_cellSize;
+    if (cellX < 0 || cellY < 0 || cellX >= m_gridWidth || cellY >= m_gridHeight)
+    {
+        return std::nullopt;
+    }
+
+    size_t cell = static_cast<size_t>(cellY) * m_gridWidth + static_cast<size_t>(cellX);
+    for (size_t i = m_cellOffsets[cell]; i < m_cellOffsets[cell + 1]; ++i)
+    {
+        size_t t = m_cellTriangles[i];
+        size_t v1 = m_topology.getCorner(t, 0);
+        size_t v2 = m_topology.getCorner(t, 1);
+        size_t v3 = m_topology.getCorner(t, 2);
+        const auto& a = getTriangulation().vertices[v1];
+        const auto& b = getTriangulation().vertices[v2];
+        const auto& c = getTriangulation().vertices[v3];
+
+        // Barycentric coordinates of point w.r.t. the (counter-clockwise) triangle.
+        double area = (b.x() - a.x()) * (c.y() - a.y()) - (b.y() - a.y()) * (c.x() - a.x());
+        double lambda1 = ((b.x() - point.x()) * (c.y() - point.y()) - (b.y() - point.y()) * (c.x() - point.x())) / area;
+        double lambda2 = ((c.x() - point.x()) * (a.y() - point.y()) - (c.y() - point.y()) * (a.x() - point.x())) / area;
+        double lambda3 = 1. - lambda1 - lambda2;
+        if (lambda1 >= -1e-12 && lambda2 >= -1e-12 && lambda3 >= -1e-12)
+        {
+            return lambda1 * m_elevations[v1] + lambda2 * m_elevations[v2] + lambda3 * m_elevations[v3];
+        }
+    }
+
+    return std::nullopt;
+}
+
+ContourLines TerrainTriangulation::computeContours(std::vector<double> levels, size_t numThreads) const
+{
+    std::sort(levels.begin(), levels.end());
+    levels.erase(std::unique(levels.begin(), levels.end()), levels.end());
+
+    const auto& edges = m_topology.getEdges();
+
+    // Pass over all triangles, each thread collecting the segments it finds per level.
+    size_t numTriangles = m_topology.getNumTriangles();
+    size_t numChunks = std::min(utility::getNumThreads(numThreads), std::max<size_t>(1, numTriangles));
+    std::vector<std::vector<std::vector<ContourSegment>>> chunkSegments(numChunks, std::vector<std::vector<ContourSegment>>(levels.size()));
+    utility::parallelForChunks(numTriangles, numChunks, [&](size_t begin, size_t end, size_t chunkIdx)
+    {
+        auto& segmentsPerLevel = chunkSegments[chunkIdx];
+        for (size_t t = begin; t < end; ++t)
+        {
+            double z[3];
+            for (size_t k = 0; k < 3; ++k)
+            {
+                z[k] = m_elevations[m_topology.getCorner(t, k)];
+            }
+
+            // A triangle is crossed by exactly the levels l with min z < l <= max z.
+            auto firstLevel = std::upper_bound(levels.begin(), levels.end(), std::min({z[0], z[1], z[2]}));
+            auto lastLevel = std::upper_bound(levels.begin(), levels.end(), std::max({z[0], z[1], z[2]}));
+            for (auto levelIt = firstLevel; levelIt != lastLevel; ++levelIt)
+            {
+                // Walking counter-clockwise, the contour enters the triangle through the edge going downhill across
+                // the level and leaves it through the edge going uphill, so that higher ground is to its left.
+                ContourSegment segment{};
+                for (size_t k = 0; k < 3; ++k)
+                {
+                    bool isFromAbove = z[k] >= *levelIt;
+                    bool isToAbove = z[(k + 1) % 3] >= *levelIt;
+                    if (isFromAbove && !isToAbove) segment.fromEdge = m_topology.getEdgeIndex(3 * t + k);
+                    if (!isFromAbove && isToAbove) segment.toEdge = m_topology.getEdgeIndex(3 * t + k);
+                }
+                segmentsPerLevel[levelIt - levels.begin()].push_back(segment);
+            }
+        }
+    });
+
+    // Chain the segments into polylines, one level at a time.
+    std::vector<LevelContours> levelContours(levels.size());
+    size_t numLevelChunks = std::min(utility::getNumThreads(numThreads), std::max<size_t>(1, levels.size()));
+    utility::parallelForChunks(levels.size(), numLevelChunks, [&](size_t begin, size_t end, size_t)
+    {
+        for (size_t l = begin; l < end; ++l)
+        {
+            std::vector<ContourSegment> segments;
+            for (const auto& segmentsPerLevel : chunkSegments)
+            {
+                segments.insert(segments.end(), segmentsPerLevel[l].begin(), segmentsPerLevel[l].end());
+            }
+
+            double level = levels[l];
+            levelContours[l] = chainContourSegments(segments, [this, &edges, level](size_t edge)
+            {
+                const auto& [v1, v2] = edges[edge];
+                double t = (level - m_elevations[v1]) / (m_elevations[v2] - m_elevations[v1]);
+                const auto& p1 = getTriangulation().vertices[v1];
+                const auto& p2 = getTriangulation().vertices[v2];
+                return primitives::Point(p1.x() + t * (p2.x() - p1.x()), p1.y() + t * (p2.y() - p1.y()));
+            });
+        }
+    });
+
+    ContourLines contours;
+    contours.levels = levels;
+    contours.levelOffsets.push_back(0);
+    for (const auto& levelContour : levelContours)
+    {
+        size_t pointOffset = contours.points.size();
+        for (size_t p = 0; p + 1 < levelContour.polylineOffsets.size(); ++p)
+        {
+            contours.polylineOffsets.push_back(pointOffset + levelContour.polylineOffsets[p]);
+        }
+        contours.points.insert(contours.points.end(), levelContour.points.begin(), levelContour.points.end());
+        contours.isClosed.insert(contours.isClosed.end(), levelContour.isClosed.begin(), levelContour.isClosed.end());
+        contours.levelOffsets.push_back(contours.isClosed.size());
+    }
+    contours.polylineOffsets.push_back(contours.points.size());
+
+    return contours;
+}
+
+} // namespace algorithms
@@ -0,0 +1,65 @@
+#ifndef ALGORITHMS_DELAUNAY_TERRAIN_HPP_INCLUDED
+#define ALGORITHMS_DELAUNAY_TERRAIN_HPP_INCLUDED
+
+#include "primitives/point.hpp"
+#include "triangulation.hpp"
+#include "topology.hpp"
+
+#include <optional>
+#include <vector>
+
+namespace algorithms
+{
+
+/// @brief Contour lines (isolines) of a terrain at a number of levels, stored in flat arrays.
+///        Polyline p consists of points[polylineOffsets[p]], ..., points[polylineOffsets[p + 1] - 1], and the polylines
+///        at levels[l] are polylineOffsets[levelOffsets[l]], ..., polylineOffsets[levelOffsets[l + 1] - 1].
+///        Polylines are oriented such that higher ground is to their left. Closed polylines don't repeat their first point.
+struct ContourLines
+{
+    std::vector<double> levels;
+    std::vector<primitives::Point> points;
+    std::vector<size_t> polylineOffsets;
+    std::vector<size_t> levelOffsets;
+    std::vector<bool> isClosed;
+};
+
+/// @brief A triangulated irregular network (TIN): A Delaunay triangulation of the xy-coordinates of the input points,
+///        where every vertex additionally carries an elevation, which is linearly interpolated over the triangles.
+struct TerrainTriangulation
+{
+    /// @brief Triangulates the points. Throws if the sizes don't match or the triangulation fails.
+    TerrainTriangulation(std::vector<primitives::Point> points, std::vector<double> elevations);
+
+    const Triangulation& getTriangulation() const { return m_topology.getTriangulation(); }
+    const TriangulationTopology& getTopology() const { return m_topology; }
+    const std::vector<double>& getElevations() const { return m_elevations; }
+
+    /// @brief Interpolates the elevation at <point>.
+    /// @return The elevation, or nullopt if <point> is not covered by the triangulation.
+    std::optional<double> getElevation(const primitives::Point& point) const;
+
+    /// @brief Slices the terrain at all <levels> in a single pass over the triangles, which is split over
+    ///        <numThreads> threads (0 meaning all hardware threads). Vertices lying exactly at a level are
+    ///        considered to be above it, so that contours never pass through vertices.
+    ContourLines computeContours(std::vector<double> levels, size_t numThreads = 0) const;
+
+private:
+    TriangulationTopology m_topology;
+    std::vector<double> m_elevations;
+
+    // Uniform grid over the bounding box for point location. Cell (i, j) holds the triangles whose bounding box
+    // overlaps it, namely m_cellTriangles[m_cellOffsets[j * m_gridWidth + i]], ..., m_cellTriangles[m_cellOffsets[j * m_gridWidth + i + 1] - 1].
+    primitives::Point m_gridOrigin;
+    double m_cellSize = 1.;
+    size_t m_gridWidth = 0;
+    size_t m_gridHeight = 0;
+    std::vector<size_t> m_cellOffsets;
+    std::vector<size_t> m_cellTriangles;
+
+    void buildLocationGrid();
+};
+
+} // namespace algorithms
+
+#endif // ALGORITHMS_DELAUNAY_TERRAIN_HPP_INCLUDED
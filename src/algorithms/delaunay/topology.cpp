@@ -0,0 +1,79 @@
+#include "topology.hpp"
+
+#include <algorithm>
+#include <stdexcept>
+#include <tuple>
+
+namespace algorithms
+{
+
+TriangulationTopology::TriangulationTopology(Triangulation triangulation) : m_triangulation(std::move(triangulation))
+{
+    const auto& indices = m_triangulation.indices;
+
+    // Sorting the half-edges by their (undirected) end points puts the two half-edges of every interior edge next to each other.
+    std::vector<std::tuple<size_t, size_t, size_t>> records;
+    records.reserve(indices.size());
+    for (size_t halfEdge = 0; halfEdge < indices.size(); ++halfEdge)
+    {
+        size_t from = indices[halfEdge];
+        size_t to = indices[halfEdge - halfEdge % 3 + (halfEdge + 1) % 3];
+        records.push_back({std::min(from, to), std::max(from, to), halfEdge});
+    }
+    std::sort(records.begin(), records.end());
+
+    m_neighbours.assign(indices.size(), NoTriangle);
+    m_edgeIndices.resize(indices.size());
+    for (size_t i = 0; i < records.size(); ++i)
+    {
+        const auto& [minVertex, maxVertex, halfEdge] = records[i];
+        if (m_edges.empty() || m_edges.back() != Edge(minVertex, maxVertex))
+        {
+            m_edges.push_back({minVertex, maxVertex});
+        }
+        else
+        {
+            size_t twin = std::get<2>(records[i - 1]);
+            m_neighbours[halfEdge] = twin / 3;
+            m_neighbours[twin] = halfEdge / 3;
+        }
+        m_edgeIndices[halfEdge] = m_edges.size() - 1;
+    }
+
+    // Any incident triangle will do for interior vertices, but for boundary vertices we want the one, which has
+    // the boundary on its clockwise side, so that walking counter-clockwise from it visits the whole fan.
+    m_incidentTriangles.assign(m_triangulation.vertices.size(), NoTriangle);
+    for (size_t halfEdge = 0; halfEdge < indices.size(); ++halfEdge)
+    {
+        size_t& incidentTriangle = m_incidentTriangles[indices[halfEdge]];
+        if (incidentTriangle == NoTriangle || m_neighbours[halfEdge] == NoTriangle)
+        {
+            incidentTriangle = halfEdge / 3;
+        }
+    }
+}
+
+size_t TriangulationTopology::getLocalIndex(size_t triangle, size_t vertex) const
+{
+    for (size_t k = 0; k < 3; ++k)
+    {
+        if (getCorner(triangle, k) == vertex) return k;
+    }
+
+    throw std::logic_error("Vertex is not a corner of triangle.");
+}
+
+std::array<size_t, 3> TriangulationTopology::getTriangleNeighbours(size_t triangle) const
+{
+    return {m_neighbours[3 * triangle], m_neighbours[3 * triangle + 1], m_neighbours[3 * triangle + 2]};
+}
+
+bool TriangulationTopology::isBoundaryVertex(size_t vertex) const
+{
+    size_t triangle = m_incidentTriangles[vertex];
+    if (triangle == NoTriangle) return true;
+
+    return getOppositeTriangle(triangle, getLocalIndex(triangle, vertex)) == NoTriangle;
+}
+
+} // namespace algorithms
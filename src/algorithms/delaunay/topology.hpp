@@ -0,0 +1,162 @@
+#ifndef ALGORITHMS_DELAUNAY_TOPOLOGY_HPP_INCLUDED
+#define ALGORITHMS_DELAUNAY_TOPOLOGY_HPP_INCLUDED
+
+#include "triangulation.hpp"
+
+#include <array>
+#include <iterator>
+#include <limits>
+#include <ranges>
+#include <vector>
+
+namespace algorithms
+{
+
+constexpr size_t NoTriangle = std::numeric_limits<size_t>::max();
+
+struct TriangulationTopology;
+
+/// @brief Forward iterator walking counter-clockwise around a vertex, yielding either the neighbouring vertices
+///        (the one-ring) or the incident triangles. Iteration ends when the walk comes back to where it started,
+///        or, for boundary vertices, when it hits the boundary. It only holds a few indices, so it never allocates.
+template<bool YieldsTriangles>
+struct StarIterator
+{
+    using value_type = size_t;
+    using difference_type = std::ptrdiff_t;
+
+    StarIterator() = default;
+    StarIterator(const TriangulationTopology* topology, size_t vertex);
+
+    size_t operator*() const;
+    StarIterator& operator++();
+    StarIterator operator++(int) { auto copy = *this; ++*this; return copy; }
+
+    bool operator==(const StarIterator& other) const
+    {
+        return m_triangle == other.m_triangle && m_isPastLastTriangle == other.m_isPastLastTriangle;
+    }
+    bool operator==(std::default_sentinel_t) const { return m_triangle == NoTriangle; }
+
+private:
+    const TriangulationTopology* m_topology = nullptr;
+    size_t m_vertex = 0;
+    size_t m_startTriangle = NoTriangle;
+    size_t m_triangle = NoTriangle;
+    // The one-ring of a boundary vertex has one vertex more than it has triangles. That last vertex is
+    // yielded from the last triangle after the walk has hit the boundary.
+    bool m_isPastLastTriangle = false;
+};
+
+template<bool YieldsTriangles>
+struct StarRange : std::ranges::view_interface<StarRange<YieldsTriangles>>
+{
+    StarRange() = default;
+    StarRange(const TriangulationTopology* topology, size_t vertex) : m_topology(topology), m_vertex(vertex) {}
+
+    StarIterator<YieldsTriangles> begin() const { return StarIterator<YieldsTriangles>(m_topology, m_vertex); }
+    std::default_sentinel_t end() const { return std::default_sentinel; }
+
+private:
+    const TriangulationTopology* m_topology = nullptr;
+    size_t m_vertex = 0;
+};
+
+/// @brief Counter-clockwise neighbours of a vertex.
+using VertexRing = StarRange<false>;
+/// @brief Counter-clockwise triangles around a vertex.
+using IncidentTriangles = StarRange<true>;
+
+/// @brief Adjacency information of a triangulation, computed once so that neighbourhoods can be traversed
+///        without searching the edge map and without allocating.
+///        Local edge k of triangle t, also called half-edge 3 * t + k, goes from corner k to corner (k + 1) % 3.
+///        NB: Assumes that the triangulation is a manifold, i. e., that every edge has at most two triangles and
+///        that the triangles around every vertex form a single fan.
+struct TriangulationTopology
+{
+    TriangulationTopology(Triangulation triangulation);
+
+    const Triangulation& getTriangulation() const { return m_triangulation; }
+    size_t getNumTriangles() const { return m_triangulation.indices.size() / 3; }
+
+    size_t getCorner(size_t triangle, size_t localIdx) const { return m_triangulation.indices[3 * triangle + localIdx]; }
+    /// @brief Throws if <vertex> is not a corner of <triangle>.
+    size_t getLocalIndex(size_t triangle, size_t vertex) const;
+
+    /// @brief The triangle sharing local edge <localEdge> of <triangle>, or NoTriangle if that edge is on the boundary.
+    size_t getOppositeTriangle(size_t triangle, size_t localEdge) const { return m_neighbours[3 * triangle + localEdge]; }
+    /// @brief The three triangles sharing an edge with <triangle>, in order of the local edges.
+    std::array<size_t, 3> getTriangleNeighbours(size_t triangle) const;
+
+    /// @brief Index of the undirected edge a half-edge lies on. Both half-edges of an interior edge share it.
+    size_t getEdgeIndex(size_t halfEdge) const { return m_edgeIndices[halfEdge]; }
+    /// @brief Every undirected edge once, smallest vertex index first.
+    const std::vector<Edge>& getEdges() const { return m_edges; }
+
+    /// @brief A triangle incident to <vertex>, or NoTriangle for isolated vertices. For boundary vertices
+    ///        this is the first triangle in counter-clockwise order.
+    size_t getIncidentTriangle(size_t vertex) const { return m_incidentTriangles[vertex]; }
+    bool isBoundaryVertex(size_t vertex) const;
+
+    VertexRing getVertexRing(size_t vertex) const { return VertexRing(this, vertex); }
+    IncidentTriangles getIncidentTriangles(size_t vertex) const { return IncidentTriangles(this, vertex); }
+
+private:
+    Triangulation m_triangulation;
+    std::vector<size_t> m_neighbours;
+    std::vector<size_t> m_edgeIndices;
+    std::vector<Edge> m_edges;
+    std::vector<size_t> m_incidentTriangles;
+};
+
+template<bool YieldsTriangles>
+StarIterator<YieldsTriangles>::StarIterator(const TriangulationTopology* topology, size_t vertex)
+    : m_topology(topology), m_vertex(vertex)
+{
+    m_startTriangle = topology->getIncidentTriangle(vertex);
+    m_triangle = m_startTriangle;
+}
+
+template<bool YieldsTriangles>
+size_t StarIterator<YieldsTriangles>::operator*() const
+{
+    if constexpr (YieldsTriangles)
+    {
+        return m_triangle;
+    }
+
+    size_t localIdx = m_topology->getLocalIndex(m_triangle, m_vertex);
+    return m_topology->getCorner(m_triangle, (localIdx + (m_isPastLastTriangle ? 2 : 1)) % 3);
+}
+
+template<bool YieldsTriangles>
+StarIterator<YieldsTriangles>& StarIterator<YieldsTriangles>::operator++()
+{
+    if (m_isPastLastTriangle)
+    {
+        m_triangle = NoTriangle;
+        m_isPastLastTriangle = false;
+        return *this;
+    }
+
+    // The next triangle counter-clockwise is the one across the edge from the vertex' predecessor to the vertex.
+    size_t next = m_topology->getOppositeTriangle(m_triangle, (m_topology->getLocalIndex(m_triangle, m_vertex) + 2) % 3);
+    if (next == NoTriangle && !YieldsTriangles)
+    {
+        m_isPastLastTriangle = true;
+    }
+    else
+    {
+        m_triangle = next == m_startTriangle ? NoTriangle : next;
+    }
+
+    return *this;
+}
+
+} // namespace algorithms
+
+// The ranges only refer to the topology, so iterators obtained from a temporary range stay valid.
+template<bool YieldsTriangles>
+inline constexpr bool std::ranges::enable_borrowed_range<algorithms::StarRange<YieldsTriangles>> = true;
+
+#endif // ALGORITHMS_DELAUNAY_TOPOLOGY_HPP_INCLUDED
@@ -10,13 +10,16 @@ TriangleSearchHierarchy::TriangleSearchHierarchy(const primitives::Triangle& roo
     triangles[rootTriangle] = {};
 }
 
-void TriangleSearchHierarchy::add(primitives::Triangle triangleToAdd, const std::vector<primitives::Triangle>& parents)
+void TriangleSearchHierarchy::add(primitives::Triangle triangleToAdd, const std::vector<primitives::Triangle>& parents, bool isRestored)
 {
-    if (triangles.find(triangleToAdd) != triangles.end())
+    auto triangleIt = triangles.find(triangleToAdd);
+    if (triangleIt != triangles.end() && !isRestored)
     {
         throw std::logic_error("Triangle already in search hierarchy.");
     }
-    triangles[triangleToAdd] = {};
+    // The old children of a restored triangle all lead to its new parents, so they are dropped to make it a leaf
+    // again rather than closing a cycle.
+    triangles[triangleToAdd].clear();
 
     for (const auto& parentTri : parents)
     {
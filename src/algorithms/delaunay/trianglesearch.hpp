@@ -16,7 +16,8 @@ using ChildMap = std::map<primitives::Triangle, std::vector<primitives::Triangle
 ///        A triangle is considered to be a "child" of another triangle if it was created as a result of 
 ///        either a point insertion in the parent triangle (upon which the inserted point was connected to the 
 ///        parent's corners, and the child was one of the three new triangles thus drawn) or an edge flip 
-///        (in which case the two resulting new triangles are considered children of the two triangles whose shared edge was flipped).
+///        (in which case the two resulting new triangles are considered children of the two triangles whose shared edge was flipped)
+///        or the removal of a vertex with three neighbours (in which case the remaining triangle is a child of the three removed ones).
 ///
 ///        Though this hierarchy is not actually a tree, it is still meaningfull to refer to the "root" triangle
 ///        as the triangle that contains all other triangles, and to the "leaf" triangles as the triangles that
@@ -31,7 +32,9 @@ struct TriangleSearchHierarchy
 
     primitives::Triangle getRoot() const { return root; }
 
-    void add(primitives::Triangle triangleToAdd, const std::vector<primitives::Triangle>& parents);
+    /// @brief Throws if <triangleToAdd> is already in the hierarchy, unless <isRestored> is set because a vertex
+    ///        inside the triangle has been removed again. The triangle then becomes a leaf again.
+    void add(primitives::Triangle triangleToAdd, const std::vector<primitives::Triangle>& parents, bool isRestored = false);
 
     primitives::Triangle getContainingLeafTriangle(primitives::Point point) const;
 
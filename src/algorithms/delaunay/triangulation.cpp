@@ -3,14 +3,43 @@
 #include "trianglesearch.hpp"
 
 #include <glm/vec2.hpp>
+#include <glm/vec3.hpp>
 
 #include <fstream>
 #include <algorithm>
 #include <iostream>
+#include <tuple>
 
 namespace algorithms
 {
 
+namespace
+{
+
+double orientationDeterminant(const primitives::Point& a, const primitives::Point& b, const primitives::Point& c)
+{
+    return (b.x() - a.x()) * (c.y() - a.y()) - (b.y() - a.y()) * (c.x() - a.x());
+}
+
+bool isStrictlyInside(const primitives::Point& point, const primitives::Point& a, const primitives::Point& b, const primitives::Point& c)
+{
+    double orientation1 = orientationDeterminant(a, b, point);
+    double orientation2 = orientationDeterminant(b, c, point);
+    double orientation3 = orientationDeterminant(c, a, point);
+    return (orientation1 > 0 && orientation2 > 0 && orientation3 > 0) || (orientation1 < 0 && orientation2 < 0 && orientation3 < 0);
+}
+
+} // namespace
+
+DelaunayTriangulator::DelaunayTriangulator(std::vector<primitives::Point> points, std::vector<double> weights)
+    : m_vertices(points), m_weights(weights)
+{
+    if (m_weights.size() != m_vertices.size())
+    {
+        throw std::invalid_argument("Expected exactly one weight per point.");
+    }
+}
+
 void DelaunayTriangulator::addEdge(size_t v1, size_t v2, bool legalizeAfterInsertion)
 {
     if (v1 == v2)
@@ -162,6 +191,96 @@ Edge DelaunayTriangulator::flipEdge(Edge edge)
     return {newEndPoint0, *newEndPoint1};
 }
 
+int DelaunayTriangulator::getPowerTestSign(size_t v1, size_t v2, size_t v3, size_t vTest) const
+{
+    const auto& d = m_vertices[vTest];
+    double liftedD = d.squareNorm() - m_weights[vTest];
+    auto lift = [this, &d, liftedD](size_t vIdx)
+    {
+        const auto& p = m_vertices[vIdx];
+        return glm::dvec3(p.x() - d.x(), p.y() - d.y(), p.squareNorm() - m_weights[vIdx] - liftedD);
+    };
+    auto liftedA = lift(v1);
+    auto liftedB = lift(v2);
+    auto liftedC = lift(v3);
+    double powerDeterminant = liftedA.x * (liftedB.y * liftedC.z - liftedB.z * liftedC.y)
+                            - liftedA.y * (liftedB.x * liftedC.z - liftedB.z * liftedC.x)
+                            + liftedA.z * (liftedB.x * liftedC.y - liftedB.y * liftedC.x);
+
+    // The rounding error of the determinant grows with the magnitude of its terms, i. e., with the coordinates
+    // and weights, so the threshold is relative to the sum of their absolute values.
+    double magnitude = std::abs(liftedA.x) * (std::abs(liftedB.y * liftedC.z) + std::abs(liftedB.z * liftedC.y))
+                     + std::abs(liftedA.y) * (std::abs(liftedB.x * liftedC.z) + std::abs(liftedB.z * liftedC.x))
+                     + std::abs(liftedA.z) * (std::abs(liftedB.x * liftedC.y) + std::abs(liftedB.y * liftedC.x));
+    double orientation = orientationDeterminant(m_vertices[v1], m_vertices[v2], m_vertices[v3]);
+    if (std::abs(powerDeterminant) <= 1e-12 * magnitude || orientation == 0)
+    {
+        return 0;
+    }
+
+    return (powerDeterminant > 0) == (orientation > 0) ? 1 : -1;
+}
+
+bool DelaunayTriangulator::isEdgeIllegal(Edge edge, size_t opposingV1, size_t opposingV2) const
+{
+    if (!isWeighted())
+    {
+        const auto& a = m_vertices[edge.first];
+        const auto& b = m_vertices[edge.second];
+        const auto& c = m_vertices[opposingV1];
+        const auto& d = m_vertices[opposingV2];
+        return primitives::Triangle(a, b, c).getCircumcircle().contains(d);
+    }
+
+    return getPowerTestSign(edge.first, edge.second, opposingV1, opposingV2) > 0;
+}
+
+bool DelaunayTriangulator::hasEdge(Edge edge) const
+{
+    auto [startIt, endIt] = m_edges.equal_range(edge.first);
+    return std::find_if(startIt, endIt, [&edge](const std::pair<size_t, size_t>& nbr) { return nbr.second == edge.second; }) != endIt;
+}
+
+std::optional<std::array<size_t, 3>> DelaunayTriangulator::removeReflexVertex(Edge edge, size_t opposingV1, size_t opposingV2)
+{
+    for (size_t reflexV : {edge.first, edge.second})
+    {
+        size_t otherV = reflexV == edge.first ? edge.second : edge.first;
+        if (!isStrictlyInside(m_vertices[reflexV], m_vertices[otherV], m_vertices[opposingV1], m_vertices[opposingV2]))
+        {
+            continue;
+        }
+        // Otherwise some of the triangles around the reflex vertex have to be flipped first.
+        if (m_edges.count(reflexV) != 3)
+        {
+            return std::nullopt;
+        }
+
+        m_edges.erase(reflexV);
+        for (size_t nbr : {otherV, opposingV1, opposingV2})
+        {
+            auto [startIt, endIt] = m_edges.equal_range(nbr);
+            m_edges.erase(std::find_if(startIt, endIt, [reflexV](const std::pair<size_t, size_t>& edge) { return edge.second == reflexV; }));
+        }
+
+        if (searchHierarchy.has_value())
+        {
+            searchHierarchy->add
+            (
+                primitives::Triangle(m_vertices[otherV], m_vertices[opposingV1], m_vertices[opposingV2]),
+                {primitives::Triangle(m_vertices[reflexV], m_vertices[otherV], m_vertices[opposingV1]),
+                 primitives::Triangle(m_vertices[reflexV], m_vertices[opposingV1], m_vertices[opposingV2]),
+                 primitives::Triangle(m_vertices[reflexV], m_vertices[opposingV2], m_vertices[otherV])},
+                true
+            );
+        }
+
+        return std::array<size_t, 3>{otherV, opposingV1, opposingV2};
+    }
+
+    return std::nullopt;
+}
+
 int DelaunayTriangulator::legalizeEdges(std::vector<Edge> legalizationCandidates)
 {
     int numLegalizedEdges = 0;
@@ -169,8 +288,7 @@ int DelaunayTriangulator::legalizeEdges(std::vector<Edge> legalizationCandidates
     auto insertEdgeIfNotLegal = [this, &edgesToLegalize](Edge edge)
     {
         auto [opposingV1, opposingV2] = getOpposingVerticesToEdge(edge);
-        if (opposingV2.has_value() 
-            && primitives::Triangle(m_vertices[edge.first], m_vertices[edge.second], m_vertices[opposingV1]).getCircumcircle().contains(m_vertices[*opposingV2]))
+        if (opposingV2.has_value() && isEdgeIllegal(edge, opposingV1, *opposingV2))
         {
             edgesToLegalize.insert({std::min(edge.first, edge.second), std::max(edge.first, edge.second)});
         }
@@ -190,12 +308,71 @@ int DelaunayTriangulator::legalizeEdges(std::vector<Edge> legalizationCandidates
         }
     }
 
+    // Illegal edges of weighted triangulations, which can neither be flipped nor removed together with their
+    // reflex vertex yet. They are retried once the other edges have been legalized, as long as that changes anything.
+    std::set<Edge> blockedEdges;
+    int numLegalizedBeforeRetry = 0;
     while (!edgesToLegalize.empty())
     {
-        ++numLegalizedEdges;
         auto edgeToFlip = *edgesToLegalize.begin();
         edgesToLegalize.erase(edgesToLegalize.begin());
 
+        if (isWeighted())
+        {
+            // Removing vertices also removes edges, and both that and flips may have legalized the edge meanwhile.
+            std::optional<size_t> opposingV2;
+            size_t opposingV1 = 0;
+            if (hasEdge(edgeToFlip))
+            {
+                std::tie(opposingV1, opposingV2) = getOpposingVerticesToEdge(edgeToFlip);
+            }
+            if (!opposingV2.has_value() || !isEdgeIllegal(edgeToFlip, opposingV1, *opposingV2))
+            {
+                continue;
+            }
+
+            // If the quadrilateral around the edge is not convex, the edge can't be flipped. But if the reflex
+            // vertex has only three neighbours, it is redundant and is removed, leaving one triangle (3-1 flip).
+            const auto& a = m_vertices[edgeToFlip.first];
+            const auto& b = m_vertices[edgeToFlip.second];
+            if (orientationDeterminant(m_vertices[opposingV1], m_vertices[*opposingV2], a)
+                * orientationDeterminant(m_vertices[opposingV1], m_vertices[*opposingV2], b) >= 0)
+            {
+                auto remainingTriangle = removeReflexVertex(edgeToFlip, opposingV1, *opposingV2);
+                if (!remainingTriangle.has_value())
+                {
+                    blockedEdges.insert(edgeToFlip);
+                }
+                else
+                {
+                    ++numLegalizedEdges;
+                    const auto& [v1, v2, v3] = *remainingTriangle;
+                    insertEdgeIfNotLegal({v1, v2});
+                    insertEdgeIfNotLegal({v2, v3});
+                    insertEdgeIfNotLegal({v3, v1});
+                }
+            }
+            else
+            {
+                ++numLegalizedEdges;
+                auto flippedEdge = flipEdge(edgeToFlip);
+
+                insertEdgeIfNotLegal({flippedEdge.first, edgeToFlip.first});
+                insertEdgeIfNotLegal({flippedEdge.first, edgeToFlip.second});
+                insertEdgeIfNotLegal({flippedEdge.second, edgeToFlip.first});
+                insertEdgeIfNotLegal({flippedEdge.second, edgeToFlip.second});
+            }
+
+            if (edgesToLegalize.empty() && !blockedEdges.empty() && numLegalizedEdges > numLegalizedBeforeRetry)
+            {
+                numLegalizedBeforeRetry = numLegalizedEdges;
+                edgesToLegalize = std::move(blockedEdges);
+                blockedEdges.clear();
+            }
+            continue;
+        }
+
+        ++numLegalizedEdges;
         auto flippedEdge = flipEdge(edgeToFlip);
 
         insertEdgeIfNotLegal({flippedEdge.first, edgeToFlip.first});
@@ -212,8 +389,7 @@ bool DelaunayTriangulator::isDelaunay() const
     for (const auto& [v1, v2] : m_edges)
     {
         auto [opposingV1, opposingV2] = getOpposingVerticesToEdge({v1, v2});
-        if (opposingV2.has_value() 
-            && primitives::Triangle(m_vertices[v1], m_vertices[v2], m_vertices[opposingV1]).getCircumcircle().contains(m_vertices[*opposingV2]))
+        if (opposingV2.has_value() && isEdgeIllegal({v1, v2}, opposingV1, *opposingV2))
         {
             return false;
         }
@@ -240,6 +416,10 @@ bool DelaunayTriangulator::performTriangulation()
     m_vertices.push_back(infinityPointNorth);
     m_vertices.push_back(infinityPointSouthWest);
     m_vertices.push_back(infinityPointSouthEast);
+    if (isWeighted())
+    {
+        m_weights.resize(m_vertices.size(), 0.);
+    }
     addEdge(m_vertices.size() - 3, m_vertices.size() - 2, false);
     addEdge(m_vertices.size() - 2, m_vertices.size() - 1, false);
     addEdge(m_vertices.size() - 1, m_vertices.size() - 3, false);
@@ -261,6 +441,12 @@ bool DelaunayTriangulator::performTriangulation()
 
             const auto& containingTriangle = searchHierarchy->getContainingLeafTriangle(vertex);
             std::vector<primitives::Point> triCorners{containingTriangle.getPoint1(), containingTriangle.getPoint2(), containingTriangle.getPoint3()};
+            // A vertex whose lifted point lies above the plane through the lifted corners of its triangle is
+            // redundant, since it would lose every power test around it.
+            if (isWeighted() && getPowerTestSign(pointToIdxMap[triCorners[0]], pointToIdxMap[triCorners[1]], pointToIdxMap[triCorners[2]], vIdx) < 0)
+            {
+                continue;
+            }
             std::vector<Edge> edgesToLegalize;
             for (int i = 0; i < 3; ++i)
             {
@@ -278,6 +464,7 @@ bool DelaunayTriangulator::performTriangulation()
     {
         std::cerr << "Failed to triangulate points: \n" << e.what() << std::endl;
         m_vertices.resize(m_vertices.size() - 3);
+        if (isWeighted()) m_weights.resize(m_vertices.size());
         m_edges.clear();
         searchHierarchy = std::nullopt;
 
@@ -286,6 +473,7 @@ bool DelaunayTriangulator::performTriangulation()
 
 
     m_vertices.resize(m_vertices.size() - 3);
+    if (isWeighted()) m_weights.resize(m_vertices.size());
 
     for (auto it = m_edges.begin(); it != m_edges.end();)
     {
@@ -304,5 +492,29 @@ bool DelaunayTriangulator::performTriangulation()
     return true;
 }
 
+Triangulation DelaunayTriangulator::getTriangulation() const
+{
+    Triangulation triangulation;
+    triangulation.vertices = m_vertices;
+
+    for (const auto& [v1, v2] : m_edges)
+    {
+        if (v1 > v2) continue;
+
+        auto [opposingV1, opposingV2] = getOpposingVerticesToEdge({v1, v2}, false);
+        // Every triangle is seen from all three of its edges. Only report it from the edge
+        // consisting of its two smallest vertex indices.
+        for (auto opposing : {std::optional<size_t>(opposingV1), opposingV2})
+        {
+            if (!opposing.has_value() || *opposing < v2) continue;
+
+            bool isCCW = orientationDeterminant(m_vertices[v1], m_vertices[v2], m_vertices[*opposing]) > 0;
+            triangulation.indices.insert(triangulation.indices.end(), {v1, isCCW ? v2 : *opposing, isCCW ? *opposing : v2});
+        }
+    }
+
+    return triangulation;
+}
+
 
 } // namespace algorithms
\ No newline at end of file
@@ -5,6 +5,7 @@
 #include "primitives/triangle.hpp"
 #include "trianglesearch.hpp"
 
+#include <array>
 #include <vector>
 #include <map>
 #include <set>
@@ -17,6 +18,8 @@ namespace fs = std::filesystem;
 namespace algorithms
 {
 
+/// @brief Flat, index based triangle mesh. Every three consecutive entries of <indices> form a triangle,
+///        whose corners are given in counter-clockwise order.
 struct Triangulation 
 {
     std::vector<primitives::Point> vertices;
@@ -29,6 +32,12 @@ struct DelaunayTriangulator
 {
     DelaunayTriangulator() = default;
     DelaunayTriangulator(std::vector<primitives::Point> points) : m_vertices(points) {}
+    /// @brief Sets up a weighted (regular) triangulation, in which the incircle test is replaced
+    ///        by the power test: the lifted point (x, y, x^2 + y^2 - w) of an opposing vertex must lie above
+    ///        the plane through the lifted corners of the triangle. With all weights equal this is a Delaunay triangulation.
+    ///        NB: Points which are redundant in the regular triangulation (i. e., whose weight is so small that their
+    ///        power cell is empty) keep their index in the vertex list, but are left without any edges.
+    DelaunayTriangulator(std::vector<primitives::Point> points, std::vector<double> weights);
 
     /// @brief Performs a Delaunay triangulation of the current set of vertices.
     ///        If the triangulation already has edges, they are cleared first.
@@ -39,20 +48,31 @@ struct DelaunayTriangulator
 
     /// @brief Checks if all edges are Delaunay by checking whether the triangles formed by their opposing
     ///        vertices have circumcircles that contain no other vertices.
+    ///        For weighted triangulations the power test is used instead.
     /// @return Whether all edges are Delaunay or not.
     bool isDelaunay() const;
 
     /// @brief Legalizes edges in the triangulation, and also "recursively" (though not actually implemented
     /// as a recursive function) legalizes edges that are created as a result of any edge flips on the way.
     /// @param legalizationCandidates Edge candidates to consider first. If empty, all edges are considered.
-    /// @return The number of edge flips made during the legalization process.
+    ///        In weighted triangulations an illegal edge which can't be flipped, because its quadrilateral is not convex,
+    ///        is removed together with the reflex vertex once that vertex has only three neighbours left.
+    /// @return The number of edge flips and vertex removals made during the legalization process.
     int legalizeEdges(std::vector<Edge> legalizationCandidates = {});
 
+    /// @brief Collects the triangles of the current triangulation.
+    /// @return The vertices and a flat index buffer of counter-clockwise oriented triangles.
+    Triangulation getTriangulation() const;
+
     const std::vector<primitives::Point>& getVertices() const { return m_vertices; };
     const std::multimap<size_t, size_t>& getEdges() const { return m_edges; };
+    /// @brief Empty for unweighted triangulations. Otherwise holds one weight per vertex.
+    const std::vector<double>& getWeights() const { return m_weights; };
+    bool isWeighted() const { return !m_weights.empty(); }
     
 protected:
     std::vector<primitives::Point> m_vertices;
+    std::vector<double> m_weights;
     std::multimap<size_t, size_t> m_edges;
 
     // Utility stuff
@@ -60,6 +80,15 @@ protected:
     void addEdge(size_t v1, size_t v2, bool legalizeAfterInsertion = true);
     // NB: throws if called on exterior edge, i. e., edge, which does not have two opposing vertices.
     Edge flipEdge(Edge edge);
+    // Incircle test for unweighted triangulations, power test for weighted ones.
+    bool isEdgeIllegal(Edge edge, size_t opposingV1, size_t opposingV2) const;
+    // Positive if the lifted <vTest> lies below the plane through the lifted <v1>, <v2> and <v3>, negative if above,
+    // and zero if the difference is within rounding errors.
+    int getPowerTestSign(size_t v1, size_t v2, size_t v3, size_t vTest) const;
+    bool hasEdge(Edge edge) const;
+    // Removes whichever vertex of <edge> lies inside the triangle formed by the other one and the opposing vertices,
+    // if it has no other neighbours. Returns the corners of the remaining triangle.
+    std::optional<std::array<size_t, 3>> removeReflexVertex(Edge edge, size_t opposingV1, size_t opposingV2);
     // Only added as a data member to not have to pass it around as a parameter to every function.
     // Should be set to nullopt whenever <performTriangulation> is not running.
     std::optional<TriangleSearchHierarchy> searchHierarchy = std::nullopt;
@@ -0,0 +1,169 @@
+#include "algorithms/hull/convexhull.hpp"
+
+#include <algorithm>
+#include <array>
+
+#include "utility/parallel.hpp"
+
+namespace algorithms
+{
+
+namespace
+{
+
+// Positive if <point> is to the left of the line through <from> and <to>.
+double getSide(const primitives::Point& from, const primitives::Point& to, const primitives::Point& point)
+{
+    return (to.x() - from.x()) * (point.y() - from.y()) - (to.y() - from.y()) * (point.x() - from.x());
+}
+
+// Exact lexicographic order, unlike primitives::operator<, which compares with a tolerance.
+bool isLexicographicallyLess(const primitives::Point& lhs, const primitives::Point& rhs)
+{
+    return lhs.x() < rhs.x() || (lhs.x() == rhs.x() && lhs.y() < rhs.y());
+}
+
+bool isSame(const primitives::Point& lhs, const primitives::Point& rhs)
+{
+    return lhs.x() == rhs.x() && lhs.y() == rhs.y();
+}
+
+// Monotone chain on points that may be reordered.
+std::vector<primitives::Point> computeHullInPlace(std::vector<primitives::Point>& points)
+{
+    std::sort(points.begin(), points.end(), isLexicographicallyLess);
+    points.erase(std::unique(points.begin(), points.end(), isSame), points.end());
+    if (points.size() < 3) return points;
+
+    // Lower hull from left to right, then upper hull from right to left, each popping vertices at which
+    // the chain doesn't turn left.
+    std::vector<primitives::Point> hull(2 * points.size());
+    size_t size = 0;
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        while (size >= 2 && getSide(hull[size - 2], hull[size - 1], points[i]) <= 0.) --size;
+        hull[size++] = points[i];
+    }
+    size_t lowerSize = size + 1;
+    for (size_t i = points.size() - 1; i > 0; --i)
+    {
+        while (size >= lowerSize && getSide(hull[size - 2], hull[size - 1], points[i - 1]) <= 0.) --size;
+        hull[size++] = points[i - 1];
+    }
+    // The last vertex repeats the first.
+    hull.resize(size - 1);
+    return hull;
+}
+
+// Extreme points in the directions of the axes and the diagonals, in counterclockwise order:
+// min y, max x - y, max x, max x + y, max y, max y - x, min x, min x + y.
+using Octagon = std::array<primitives::Point, 8>;
+
+double getScore(const primitives::Point& point, size_t direction)
+{
+    switch (direction)
+    {
+    case 0: return -point.y();
+    case 1: return point.x() - point.y();
+    case 2: return point.x();
+    case 3: return point.x() + point.y();
+    case 4: return point.y();
+    case 5: return point.y() - point.x();
+    case 6: return -point.x();
+    default: return -point.x() - point.y();
+    }
+}
+
+void mergeIntoOctagon(Octagon& octagon, const primitives::Point& point)
+{
+    for (size_t direction = 0; direction < octagon.size(); ++direction)
+    {
+        if (getScore(point, direction) > getScore(octagon[direction], direction))
+        {
+            octagon[direction] = point;
+        }
+    }
+}
+
+// Whether <point> is inside the octagon or on its boundary, so that it can't be a hull vertex unless it is
+// one of the octagon vertices.
+bool isInsideOctagon(const std::vector<primitives::Point>& octagonVertices, const primitives::Point& point)
+{
+    for (size_t i = 0; i < octagonVertices.size(); ++i)
+    {
+        if (getSide(octagonVertices[i], octagonVertices[(i + 1) % octagonVertices.size()], point) < 0.) return false;
+    }
+    return true;
+}
+
+} // namespace
+
+std::vector<primitives::Point> computeConvexHull(const std::vector<primitives::Point>& points)
+{
+    auto copy = points;
+    return computeHullInPlace(copy);
+}
+
+std::vector<primitives::Point> computeConvexHullParallel(const std::vector<primitives::Point>& points, size_t numThreads)
+{
+    if (points.empty()) return {};
+
+    size_t numChunks = std::min(utility::getNumThreads(numThreads), points.size());
+    std::vector<Octagon> chunkOctagons(numChunks);
+    utility::parallelForChunks(points.size(), numChunks,
+        [&](size_t begin, size_t end, size_t chunkIdx)
+        {
+            auto& octagon = chunkOctagons[chunkIdx];
+            octagon.fill(points[begin]);
+            for (size_t i = begin + 1; i < end; ++i)
+            {
+                mergeIntoOctagon(octagon, points[i]);
+            }
+        });
+
+    auto octagon = chunkOctagons.front();
+    for (const auto& chunkOctagon : chunkOctagons)
+    {
+        for (const auto& vertex : chunkOctagon)
+        {
+            mergeIntoOctagon(octagon, vertex);
+        }
+    }
+    std::vector<primitives::Point> octagonVertices;
+    for (const auto& vertex : octagon)
+    {
+        if (octagonVertices.empty() || (!isSame(vertex, octagonVertices.back()) && !isSame(vertex, octagonVertices.front())))
+        {
+            octagonVertices.push_back(vertex);
+        }
+    }
+    if (octagonVertices.size() < 3)
+    {
+        // All points lie on the line segment between two of them.
+        return computeHullInPlace(octagonVertices);
+    }
+
+    std::vector<std::vector<primitives::Point>> chunkHulls(numChunks);
+    utility::parallelForChunks(points.size(), numChunks,
+        [&](size_t begin, size_t end, size_t chunkIdx)
+        {
+            std::vector<primitives::Point> candidates;
+            for (size_t i = begin; i < end; ++i)
+            {
+                if (!isInsideOctagon(octagonVertices, points[i]))
+                {
+                    candidates.push_back(points[i]);
+                }
+            }
+            chunkHulls[chunkIdx] = computeHullInPlace(candidates);
+        });
+
+    std::vector<primitives::Point> candidates = octagonVertices;
+    for (const auto& chunkHull : chunkHulls)
+    {
+        candidates.insert(candidates.end(), chunkHull.begin(), chunkHull.end());
+    }
+    return computeHullInPlace(candidates);
+}
+
+} // namespace algorithms
@@ -0,0 +1,26 @@
+#ifndef CONVEXHULL_HPP_INCLUDED
+#define CONVEXHULL_HPP_INCLUDED
+
+#include <vector>
+
+#include "primitives/point.hpp"
+
+namespace algorithms
+{
+
+// Convex hull of <points> with Andrew's monotone chain in O(n log n). The hull vertices are returned in
+// counterclockwise order, starting at the one with the smallest x (and then y) coordinate, without repeated
+// or collinear vertices. Fewer than three points come back if all points are collinear.
+std::vector<primitives::Point> computeConvexHull(const std::vector<primitives::Point>& points);
+
+// Same result, computed on <numThreads> threads (0 meaning all hardware threads) for large point clouds.
+//
+// The extreme points in the directions of the axes and the diagonals span a convex octagon, and points inside
+// it can't be hull vertices (Akl-Toussaint). Finding the octagon and discarding the points inside are single
+// parallel passes, which for typical clouds leave only a small fraction of the points. Every thread then
+// computes the hull of the points left in its chunk, and the final hull is the hull of those chunk hulls.
+std::vector<primitives::Point> computeConvexHullParallel(const std::vector<primitives::Point>& points, size_t numThreads = 0);
+
+} // namespace algorithms
+
+#endif
@@ -0,0 +1,129 @@
+#include "algorithms/hull/enclosingcircle.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+#include <stdexcept>
+
+#include "utility/parallel.hpp"
+
+namespace algorithms
+{
+
+namespace
+{
+
+// Points whose distance to the center exceeds the radius by no more than this relative amount count as
+// inside, so that rounding doesn't make the points on the boundary look outside.
+constexpr double relativeTolerance = 1e-12;
+
+bool isInside(const primitives::Circle& circle, const primitives::Point& point)
+{
+    double radius = circle.getRadius();
+    return circle.getCenter().squareDistance(point) <= radius * radius * (1. + relativeTolerance);
+}
+
+primitives::Circle getDiametralCircle(const primitives::Point& p1, const primitives::Point& p2)
+{
+    primitives::Point center((p1.x() + p2.x()) / 2., (p1.y() + p2.y()) / 2.);
+    return primitives::Circle(center, p1.distance(p2) / 2.);
+}
+
+// Circle through three points. Unlike the Circle constructor, this works relative to <p1> and has no
+// absolute threshold, so it is exact enough for small triangles far from the origin, and it falls back to
+// the circle over the two points farthest apart if all three are collinear.
+primitives::Circle getCircumcircle(const primitives::Point& p1, const primitives::Point& p2, const primitives::Point& p3)
+{
+    double x2 = p2.x() - p1.x();
+    double y2 = p2.y() - p1.y();
+    double x3 = p3.x() - p1.x();
+    double y3 = p3.y() - p1.y();
+    double denominator = 2. * (x2 * y3 - y2 * x3);
+    if (denominator == 0.)
+    {
+        auto circle = getDiametralCircle(p1, p2);
+        for (auto candidate : {getDiametralCircle(p1, p3), getDiametralCircle(p2, p3)})
+        {
+            if (candidate.getRadius() > circle.getRadius()) circle = candidate;
+        }
+        return circle;
+    }
+
+    double squareNorm2 = x2 * x2 + y2 * y2;
+    double squareNorm3 = x3 * x3 + y3 * y3;
+    double centerX = (y3 * squareNorm2 - y2 * squareNorm3) / denominator;
+    double centerY = (x2 * squareNorm3 - x3 * squareNorm2) / denominator;
+    return primitives::Circle(primitives::Point(p1.x() + centerX, p1.y() + centerY), std::sqrt(centerX * centerX + centerY * centerY));
+}
+
+// Welzl's algorithm on <points>, which are shuffled in place.
+primitives::Circle computeInPlace(std::vector<primitives::Point>& points, std::minstd_rand& generator)
+{
+    if (points.empty())
+    {
+        throw std::invalid_argument("Cannot compute enclosing circle of no points.");
+    }
+    std::shuffle(points.begin(), points.end(), generator);
+
+    // Invariant of the loops: circle is the smallest circle containing the points before the current one
+    // that has the points of the enclosing loops on its boundary.
+    primitives::Circle circle(points[0], 0.);
+    for (size_t i = 1; i < points.size(); ++i)
+    {
+        if (isInside(circle, points[i])) continue;
+
+        circle = primitives::Circle(points[i], 0.);
+        for (size_t j = 0; j < i; ++j)
+        {
+            if (isInside(circle, points[j])) continue;
+
+            circle = getDiametralCircle(points[i], points[j]);
+            for (size_t k = 0; k < j; ++k)
+            {
+                if (isInside(circle, points[k])) continue;
+
+                circle = getCircumcircle(points[i], points[j], points[k]);
+            }
+        }
+    }
+    return circle;
+}
+
+} // namespace
+
+primitives::Circle computeMinimumEnclosingCircle(const std::vector<primitives::Point>& points)
+{
+    auto copy = points;
+    std::minstd_rand generator;
+    return computeInPlace(copy, generator);
+}
+
+std::vector<primitives::Circle> computeMinimumEnclosingCircles(const std::vector<std::vector<primitives::Point>>& pointSets,
+                                                               size_t numThreads)
+{
+    size_t numChunks = std::max<size_t>(1, std::min(utility::getNumThreads(numThreads), pointSets.size()));
+    std::vector<std::vector<primitives::Circle>> chunkCircles(numChunks);
+    utility::parallelForChunks(pointSets.size(), numChunks,
+        [&](size_t begin, size_t end, size_t chunkIdx)
+        {
+            std::vector<primitives::Point> buffer;
+            chunkCircles[chunkIdx].reserve(end - begin);
+            for (size_t i = begin; i < end; ++i)
+            {
+                // Seeded per set, so that the result doesn't depend on the number of threads.
+                std::minstd_rand generator;
+                buffer.assign(pointSets[i].begin(), pointSets[i].end());
+                chunkCircles[chunkIdx].push_back(computeInPlace(buffer, generator));
+            }
+        });
+
+    std::vector<primitives::Circle> circles;
+    circles.reserve(pointSets.size());
+    for (auto& chunk : chunkCircles)
+    {
+        circles.insert(circles.end(), chunk.begin(), chunk.end());
+    }
+    return circles;
+}
+
+} // namespace algorithms
@@ -0,0 +1,26 @@
+#ifndef ENCLOSINGCIRCLE_HPP_INCLUDED
+#define ENCLOSINGCIRCLE_HPP_INCLUDED
+
+#include <vector>
+
+#include "primitives/circle.hpp"
+#include "primitives/point.hpp"
+
+namespace algorithms
+{
+
+// Smallest circle containing all <points>, in expected linear time with Welzl's algorithm. The recursion of
+// the original formulation is unrolled into three nested loops over the points in random order (one for each
+// point that may be found on the boundary), so the stack depth doesn't grow with the number of points.
+// The order is drawn from a fixed seed, so the result is reproducible. Throws std::invalid_argument if there
+// are no points.
+primitives::Circle computeMinimumEnclosingCircle(const std::vector<primitives::Point>& points);
+
+// Same for many point sets on <numThreads> threads (0 meaning all hardware threads), reusing one buffer per
+// thread instead of allocating per set.
+std::vector<primitives::Circle> computeMinimumEnclosingCircles(const std::vector<std::vector<primitives::Point>>& pointSets,
+                                                               size_t numThreads = 0);
+
+} // namespace algorithms
+
+#endif
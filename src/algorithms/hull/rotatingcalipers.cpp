@@ -0,0 +1,162 @@
+#include "algorithms/hull/rotatingcalipers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+#include "utility/parallel.hpp"
+
+namespace algorithms
+{
+
+namespace
+{
+
+// Measures of hulls with less than three vertices, which have no area.
+CaliperMeasures computeDegenerateCaliperMeasures(const std::vector<primitives::Point>& hull)
+{
+    const auto& first = hull.front();
+    const auto& last = hull.back();
+    primitives::Point axis(last.x() - first.x(), last.y() - first.y());
+    if (hull.size() == 1)
+    {
+        axis = primitives::Point(1., 0.);
+    }
+    primitives::Point center((first.x() + last.x()) / 2., (first.y() + last.y()) / 2.);
+    primitives::OrientedRectangle rectangle(center, axis, first.distance(last), 0.);
+    return {{first, last}, 0., rectangle, rectangle};
+}
+
+} // namespace
+
+CaliperMeasures computeCaliperMeasures(const std::vector<primitives::Point>& hull)
+{
+    if (hull.empty())
+    {
+        throw std::invalid_argument("Hull must not be empty.");
+    }
+    if (hull.size() < 3)
+    {
+        return computeDegenerateCaliperMeasures(hull);
+    }
+
+    size_t size = hull.size();
+    auto next = [size](size_t v) { return v + 1 < size ? v + 1 : 0; };
+
+    // For every edge, the vertices farthest along it (right), farthest from it (top) and farthest against it
+    // (left). All three only move forward as the edge moves forward, so they go around the hull once in total.
+    size_t right = 1;
+    size_t top = 1;
+    size_t left = 1;
+    size_t diameterStart = 0;
+    size_t diameterEnd = 1;
+    double maxSquareDistance = hull[0].squareDistance(hull[1]);
+    double minWidth = std::numeric_limits<double>::infinity();
+    double minArea = minWidth;
+    double minPerimeter = minWidth;
+    primitives::OrientedRectangle minimumAreaRectangle(hull[0], primitives::Point(1., 0.), 0., 0.);
+    primitives::OrientedRectangle minimumPerimeterRectangle = minimumAreaRectangle;
+
+    for (size_t e = 0; e < size; ++e)
+    {
+        const auto& origin = hull[e];
+        const auto& end = hull[next(e)];
+        double length = origin.distance(end);
+        double axisX = (end.x() - origin.x()) / length;
+        double axisY = (end.y() - origin.y()) / length;
+        auto getAlong = [&](size_t v) { return (hull[v].x() - origin.x()) * axisX + (hull[v].y() - origin.y()) * axisY; };
+        auto getAcross = [&](size_t v) { return (hull[v].y() - origin.y()) * axisX - (hull[v].x() - origin.x()) * axisY; };
+
+        while (getAlong(next(right)) > getAlong(right)) right = next(right);
+        if (e == 0) top = right;
+        while (getAcross(next(top)) > getAcross(top)) top = next(top);
+        if (e == 0) left = top;
+        while (getAlong(next(left)) < getAlong(left)) left = next(left);
+
+        // The vertex farthest from the edge forms antipodal pairs with both of its end points, and every
+        // antipodal pair comes up for some edge.
+        for (size_t v : {e, next(e)})
+        {
+            double squareDistance = hull[v].squareDistance(hull[top]);
+            if (squareDistance > maxSquareDistance)
+            {
+                maxSquareDistance = squareDistance;
+                diameterStart = v;
+                diameterEnd = top;
+            }
+        }
+
+        double minAlong = getAlong(left);
+        double maxAlong = getAlong(right);
+        double width = maxAlong - minAlong;
+        double height = getAcross(top);
+        minWidth = std::min(minWidth, height);
+
+        auto getRectangle = [&]()
+        {
+            double centerAlong = (minAlong + maxAlong) / 2.;
+            double centerAcross = height / 2.;
+            primitives::Point center(origin.x() + centerAlong * axisX - centerAcross * axisY,
+                                     origin.y() + centerAlong * axisY + centerAcross * axisX);
+            return primitives::OrientedRectangle(center, primitives::Point(axisX, axisY), width, height);
+        };
+        if (width * height < minArea)
+        {
+            minArea = width * height;
+            minimumAreaRectangle = getRectangle();
+        }
+        if (width + height < minPerimeter)
+        {
+            minPerimeter = width + height;
+            minimumPerimeterRectangle = getRectangle();
+        }
+    }
+
+    return {{hull[diameterStart], hull[diameterEnd]}, minWidth, minimumAreaRectangle, minimumPerimeterRectangle};
+}
+
+std::vector<CaliperMeasures> computeCaliperMeasures(const std::vector<std::vector<primitives::Point>>& hulls, size_t numThreads)
+{
+    size_t numChunks = std::max<size_t>(1, std::min(utility::getNumThreads(numThreads), hulls.size()));
+    std::vector<std::vector<CaliperMeasures>> chunkMeasures(numChunks);
+    utility::parallelForChunks(hulls.size(), numChunks,
+        [&](size_t begin, size_t end, size_t chunkIdx)
+        {
+            chunkMeasures[chunkIdx].reserve(end - begin);
+            for (size_t i = begin; i < end; ++i)
+            {
+                chunkMeasures[chunkIdx].push_back(computeCaliperMeasures(hulls[i]));
+            }
+        });
+
+    std::vector<CaliperMeasures> measures;
+    measures.reserve(hulls.size());
+    for (auto& chunk : chunkMeasures)
+    {
+        measures.insert(measures.end(), chunk.begin(), chunk.end());
+    }
+    return measures;
+}
+
+std::pair<primitives::Point, primitives::Point> computeDiameter(const std::vector<primitives::Point>& hull)
+{
+    return computeCaliperMeasures(hull).diameter;
+}
+
+double computeWidth(const std::vector<primitives::Point>& hull)
+{
+    return computeCaliperMeasures(hull).width;
+}
+
+primitives::OrientedRectangle computeMinimumAreaRectangle(const std::vector<primitives::Point>& hull)
+{
+    return computeCaliperMeasures(hull).minimumAreaRectangle;
+}
+
+primitives::OrientedRectangle computeMinimumPerimeterRectangle(const std::vector<primitives::Point>& hull)
+{
+    return computeCaliperMeasures(hull).minimumPerimeterRectangle;
+}
+
+} // namespace algorithms
@@ -0,0 +1,43 @@
+#ifndef ROTATINGCALIPERS_HPP_INCLUDED
+#define ROTATINGCALIPERS_HPP_INCLUDED
+
+#include <utility>
+#include <vector>
+
+#include "primitives/orientedrectangle.hpp"
+#include "primitives/point.hpp"
+
+namespace algorithms
+{
+
+// All functions below take a convex polygon with its vertices in counterclockwise order and without collinear
+// vertices, as returned by computeConvexHull, and run in time linear in its size by rotating a pair or set of
+// parallel supporting lines around it. Hulls of one or two points are handled as well, where width and height
+// of the rectangles may be 0. An empty hull throws std::invalid_argument.
+
+// The two vertices farthest apart.
+std::pair<primitives::Point, primitives::Point> computeDiameter(const std::vector<primitives::Point>& hull);
+
+// The smallest distance between two parallel lines enclosing the hull.
+double computeWidth(const std::vector<primitives::Point>& hull);
+
+// Smallest enclosing rectangles, each of which has a side along an edge of the hull.
+primitives::OrientedRectangle computeMinimumAreaRectangle(const std::vector<primitives::Point>& hull);
+primitives::OrientedRectangle computeMinimumPerimeterRectangle(const std::vector<primitives::Point>& hull);
+
+struct CaliperMeasures
+{
+    std::pair<primitives::Point, primitives::Point> diameter;
+    double width;
+    primitives::OrientedRectangle minimumAreaRectangle;
+    primitives::OrientedRectangle minimumPerimeterRectangle;
+};
+
+// All of the above from one rotation around the hull.
+CaliperMeasures computeCaliperMeasures(const std::vector<primitives::Point>& hull);
+// Same for many hulls on <numThreads> threads (0 meaning all hardware threads).
+std::vector<CaliperMeasures> computeCaliperMeasures(const std::vector<std::vector<primitives::Point>>& hulls, size_t numThreads = 0);
+
+} // namespace algorithms
+
+#endif
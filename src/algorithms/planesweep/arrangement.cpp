@@ -0,0 +1,510 @@
+#include "algorithms/planesweep/arrangement.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <limits>
+#include <numeric>
+#include <stdexcept>
+#include <tuple>
+#include <unordered_map>
+
+#include "algorithms/planesweep/segmentgrid.hpp"
+
+namespace algorithms
+{
+
+namespace
+{
+
+constexpr double vertexTolerance = 1e-6;
+// Marks cycles without a containing cycle and cycles whose face is not known yet.
+constexpr size_t NoIndex = std::numeric_limits<size_t>::max();
+
+// Merges points closer than vertexTolerance into a single vertex, using a hashed grid with cells of that size.
+struct VertexSnapper
+{
+    VertexSnapper(std::vector<primitives::Point> &vertices) : m_vertices(vertices) {}
+
+    size_t getVertex(const primitives::Point &point)
+    {
+        auto cellX = static_cast<int64_t>(std::floor(point.x() / vertexTolerance));
+        auto cellY = static_cast<int64_t>(std::floor(point.y() / vertexTolerance));
+        for (int64_t dx = -1; dx <= 1; ++dx)
+        {
+            for (int64_t dy = -1; dy <= 1; ++dy)
+            {
+                auto cell = m_cells.find(getCellKey(cellX + dx, cellY + dy));
+                if (cell == m_cells.end())
+                {
+                    continue;
+                }
+                for (size_t vertex : cell->second)
+                {
+                    if (m_vertices[vertex].squareDistance(point) < vertexTolerance * vertexTolerance)
+                    {
+                        return vertex;
+                    }
+                }
+            }
+        }
+
+        m_vertices.push_back(point);
+        m_cells[getCellKey(cellX, cellY)].push_back(m_vertices.size() - 1);
+        return m_vertices.size() - 1;
+    }
+
+private:
+    static uint64_t getCellKey(int64_t cellX, int64_t cellY)
+    {
+        return static_cast<uint64_t>(cellX) * 0x9E3779B97F4A7C15ull ^ static_cast<uint64_t>(cellY);
+    }
+
+    std::vector<primitives::Point> &m_vertices;
+    // Different cells may end up under the same key, which is fine since the distances are checked anyway.
+    std::unordered_map<uint64_t, std::vector<size_t>> m_cells;
+};
+
+double getAngle(const primitives::Point &from, const primitives::Point &to)
+{
+    return std::atan2(to.y() - from.y(), to.x() - from.x());
+}
+
+} // namespace
+
+std::vector<size_t> Arrangement::getBoundaryVertices(size_t halfEdge) const
+{
+    std::vector<size_t> boundary;
+    size_t curr = halfEdge;
+    do
+    {
+        boundary.push_back(halfEdgeOrigins[curr]);
+        curr = halfEdgeNext[curr];
+    } while (curr != halfEdge);
+
+    return boundary;
+}
+
+double Arrangement::getBoundaryArea(size_t halfEdge) const
+{
+    double doubleArea = 0.;
+    size_t curr = halfEdge;
+    do
+    {
+        const auto &origin = vertices[halfEdgeOrigins[curr]];
+        const auto &target = vertices[getTarget(curr)];
+        doubleArea += origin.x() * target.y() - target.x() * origin.y();
+        curr = halfEdgeNext[curr];
+    } while (curr != halfEdge);
+
+    return doubleArea / 2.;
+}
+
+double Arrangement::getFaceArea(size_t face) const
+{
+    if (faceOuterHalfEdges[face] == NoHalfEdge)
+    {
+        throw std::invalid_argument("The unbounded face has no finite area.");
+    }
+
+    double area = getBoundaryArea(faceOuterHalfEdges[face]);
+    for (size_t i = faceHoleOffsets[face]; i < faceHoleOffsets[face + 1]; ++i)
+    {
+        area += getBoundaryArea(faceHoleHalfEdges[i]);
+    }
+    return area;
+}
+
+Arrangement computeArrangement(const std::vector<primitives::LineSegment> &segments, size_t numThreads)
+{
+    Arrangement arrangement;
+    auto &vertices = arrangement.vertices;
+    VertexSnapper snapper(vertices);
+
+    // 1. Vertices: End points and intersection points, each recorded for the line segments they lie on.
+    std::vector<std::pair<size_t, size_t>> segmentVertices;
+    for (size_t s = 0; s < segments.size(); ++s)
+    {
+        segmentVertices.push_back({s, snapper.getVertex(segments[s].getStartPoint())});
+        segmentVertices.push_back({s, snapper.getVertex(segments[s].getEndPoint())});
+    }
+
+    std::vector<SegmentIntersection> intersections;
+    SegmentGrid(segments).perform(intersections, numThreads);
+    for (const auto &intersection : intersections)
+    {
+        std::vector<primitives::Point> points;
+        if (std::holds_alternative<primitives::Point>(intersection.intersection))
+        {
+            points.push_back(std::get<primitives::Point>(intersection.intersection));
+        }
+        else
+        {
+            const auto &overlap = std::get<primitives::LineSegment>(intersection.intersection);
+            points.push_back(overlap.getStartPoint());
+            points.push_back(overlap.getEndPoint());
+        }
+
+        for (const auto &point : points)
+        {
+            size_t vertex = snapper.getVertex(point);
+            segmentVertices.push_back({intersection.firstSegment, vertex});
+            segmentVertices.push_back({intersection.secondSegment, vertex});
+        }
+    }
+
+    // 2. Edges: Consecutive vertices along each line segment, where overlapping parts of line segments are merged.
+    //    The vertices on each line segment are ordered by their parameter along it.
+    std::vector<double> parameters(segmentVertices.size());
+    for (size_t i = 0; i < segmentVertices.size(); ++i)
+    {
+        const auto &segment = segments[segmentVertices[i].first];
+        const auto &vertex = vertices[segmentVertices[i].second];
+        parameters[i] = std::abs(segment.getEndPoint().x() - segment.getStartPoint().x()) > std::abs(segment.getEndPoint().y() - segment.getStartPoint().y())
+                        ? (vertex.x() - segment.getStartPoint().x()) / (segment.getEndPoint().x() - segment.getStartPoint().x())
+                        : (vertex.y() - segment.getStartPoint().y()) / (segment.getEndPoint().y() - segment.getStartPoint().y());
+    }
+    std::vector<size_t> order(segmentVertices.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&segmentVertices, &parameters](size_t lhs, size_t rhs)
+    {
+        return std::tie(segmentVertices[lhs].first, parameters[lhs]) < std::tie(segmentVertices[rhs].first, parameters[rhs]);
+    });
+
+    // (smaller vertex, larger vertex, segment)
+    std::vector<std::tuple<size_t, size_t, size_t>> edgeSources;
+    for (size_t i = 1; i < order.size(); ++i)
+    {
+        const auto &[segment, vertex] = segmentVertices[order[i]];
+        const auto &[prevSegment, prevVertex] = segmentVertices[order[i - 1]];
+        if (segment != prevSegment || vertex == prevVertex)
+        {
+            continue;
+        }
+        edgeSources.push_back({std::min(vertex, prevVertex), std::max(vertex, prevVertex), segment});
+    }
+    std::sort(edgeSources.begin(), edgeSources.end());
+    edgeSources.erase(std::unique(edgeSources.begin(), edgeSources.end()), edgeSources.end());
+
+    auto &origins = arrangement.halfEdgeOrigins;
+    for (size_t i = 0; i < edgeSources.size(); ++i)
+    {
+        const auto &[v1, v2, segment] = edgeSources[i];
+        if (i == 0 || std::get<0>(edgeSources[i - 1]) != v1 || std::get<1>(edgeSources[i - 1]) != v2)
+        {
+            arrangement.edgeSegmentOffsets.push_back(arrangement.edgeSegments.size());
+            origins.push_back(v1);
+            origins.push_back(v2);
+        }
+        arrangement.edgeSegments.push_back(segment);
+    }
+    arrangement.edgeSegmentOffsets.push_back(arrangement.edgeSegments.size());
+    size_t numHalfEdges = origins.size();
+
+    // 3. Linking: Sort the half-edges leaving each vertex by angle. Arriving in a vertex along a half-edge,
+    //    the face on its left continues along the next outgoing half-edge clockwise from its twin.
+    std::vector<size_t> outgoingOffsets(vertices.size() + 1, 0);
+    for (size_t h = 0; h < numHalfEdges; ++h)
+    {
+        ++outgoingOffsets[origins[h] + 1];
+    }
+    for (size_t v = 0; v < vertices.size(); ++v)
+    {
+        outgoingOffsets[v + 1] += outgoingOffsets[v];
+    }
+    std::vector<size_t> outgoing(numHalfEdges);
+    {
+        auto fillPositions = outgoingOffsets;
+        for (size_t h = 0; h < numHalfEdges; ++h)
+        {
+            outgoing[fillPositions[origins[h]]++] = h;
+        }
+    }
+    std::vector<double> angles(numHalfEdges);
+    for (size_t h = 0; h < numHalfEdges; ++h)
+    {
+        angles[h] = getAngle(vertices[origins[h]], vertices[origins[Arrangement::getTwin(h)]]);
+    }
+
+    arrangement.halfEdgeNext.assign(numHalfEdges, NoHalfEdge);
+    arrangement.halfEdgePrev.assign(numHalfEdges, NoHalfEdge);
+    arrangement.vertexHalfEdges.assign(vertices.size(), NoHalfEdge);
+    for (size_t v = 0; v < vertices.size(); ++v)
+    {
+        auto begin = outgoing.begin() + outgoingOffsets[v];
+        auto end = outgoing.begin() + outgoingOffsets[v + 1];
+        std::sort(begin, end, [&angles](size_t lhs, size_t rhs) { return angles[lhs] < angles[rhs]; });
+
+        size_t degree = end - begin;
+        for (size_t i = 0; i < degree; ++i)
+        {
+            size_t incoming = Arrangement::getTwin(begin[i]);
+            size_t next = begin[(i + degree - 1) % degree];
+            arrangement.halfEdgeNext[incoming] = next;
+            arrangement.halfEdgePrev[next] = incoming;
+        }
+        if (degree > 0)
+        {
+            arrangement.vertexHalfEdges[v] = *begin;
+        }
+    }
+
+    // 4. Boundary cycles: Counterclockwise ones are outer boundaries of bounded faces, the others bound holes
+    //    (or, for the components not contained in any bounded face, the unbounded face).
+    std::vector<size_t> halfEdgeCycles(numHalfEdges, NoIndex);
+    std::vector<size_t> cycleHalfEdges;
+    for (size_t h = 0; h < numHalfEdges; ++h)
+    {
+        if (halfEdgeCycles[h] != NoIndex)
+        {
+            continue;
+        }
+        size_t curr = h;
+        do
+        {
+            halfEdgeCycles[curr] = cycleHalfEdges.size();
+            curr = arrangement.halfEdgeNext[curr];
+        } while (curr != h);
+        cycleHalfEdges.push_back(h);
+    }
+
+    size_t numCycles = cycleHalfEdges.size();
+    std::vector<size_t> cycleFaces(numCycles, NoIndex);
+    arrangement.faceOuterHalfEdges.push_back(NoHalfEdge);
+    for (size_t c = 0; c < numCycles; ++c)
+    {
+        if (arrangement.getBoundaryArea(cycleHalfEdges[c]) > 0.)
+        {
+            cycleFaces[c] = arrangement.faceOuterHalfEdges.size();
+            arrangement.faceOuterHalfEdges.push_back(cycleHalfEdges[c]);
+        }
+    }
+
+    // 5. Holes: The face containing a hole is found by casting a ray to the left from the hole's leftmost
+    //    vertex. The nearest hit edge or vertex tells the cycle bounding the face the ray passes through last.
+    //    If that is a hole cycle itself, the containing face is the one of that hole, which lies further left.
+    auto getCycleAtVertexFacingEast = [&](size_t vertex)
+    {
+        // The half-edges leaving the vertex are sorted by angle in (-pi, pi], and the face to the left of each
+        // spans the wedge up to the next one. So the wedge containing the direction 0 starts at the last
+        // half-edge with non-positive angle, or wraps around from the last one.
+        auto begin = outgoing.begin() + outgoingOffsets[vertex];
+        auto end = outgoing.begin() + outgoingOffsets[vertex + 1];
+        auto firstPositive = std::upper_bound(begin, end, 0., [&angles](double angle, size_t h) { return angle < angles[h]; });
+        size_t halfEdge = firstPositive == begin ? *(end - 1) : *(firstPositive - 1);
+        return halfEdgeCycles[halfEdge];
+    };
+
+    //    The rays are answered from a grid of the vertices and the edges crossing the rows, where each ray only
+    //    visits the non-empty cells of its row leftwards from its origin until one holds a nearer hit.
+    double gridMinX = std::numeric_limits<double>::infinity();
+    double gridMinY = std::numeric_limits<double>::infinity();
+    double gridMaxX = -std::numeric_limits<double>::infinity();
+    double gridMaxY = -std::numeric_limits<double>::infinity();
+    for (const auto &vertex : vertices)
+    {
+        gridMinX = std::min(gridMinX, vertex.x());
+        gridMinY = std::min(gridMinY, vertex.y());
+        gridMaxX = std::max(gridMaxX, vertex.x());
+        gridMaxY = std::max(gridMaxY, vertex.y());
+    }
+    size_t numEdges = numHalfEdges / 2;
+    double extentSum = 0.;
+    for (size_t h = 0; h < numHalfEdges; h += 2)
+    {
+        const auto &origin = vertices[origins[h]];
+        const auto &target = vertices[origins[h + 1]];
+        extentSum += std::max(std::abs(target.x() - origin.x()), std::abs(target.y() - origin.y()));
+    }
+    // Same cell size as for a SegmentGrid of the edges.
+    double gridWidth = gridMaxX - gridMinX;
+    double gridHeight = gridMaxY - gridMinY;
+    double cellSize = numEdges == 0 ? 1. : std::max(extentSum / numEdges, std::max(std::sqrt(gridWidth * gridHeight / numEdges), std::max(gridWidth, gridHeight) / numEdges));
+    size_t numCellsX = numEdges == 0 ? 1 : static_cast<size_t>(gridWidth / cellSize) + 1;
+    size_t numCellsY = numEdges == 0 ? 1 : static_cast<size_t>(gridHeight / cellSize) + 1;
+    auto getCellX = [&](double x) { return std::min(numCellsX - 1, static_cast<size_t>(std::max(0., (x - gridMinX) / cellSize))); };
+    auto getCellY = [&](double y) { return std::min(numCellsY - 1, static_cast<size_t>(std::max(0., (y - gridMinY) / cellSize))); };
+    auto getCellKey = [numCellsX](size_t cellX, size_t cellY) { return static_cast<uint64_t>(cellY) * numCellsX + cellX; };
+
+    // (cell key, item), where the items are the vertices followed by the edges, each edge as its half-edge
+    // pointing upwards. A vertex is in the rows within the tolerance of it, as is each edge crossing them.
+    // Edges spanning less than the tolerance band are never hit, only their vertices.
+    std::vector<std::pair<uint64_t, size_t>> cellReferences;
+    for (size_t v = 0; v < vertices.size(); ++v)
+    {
+        if (outgoingOffsets[v] == outgoingOffsets[v + 1])
+        {
+            continue;
+        }
+        size_t cellX = getCellX(vertices[v].x());
+        for (size_t cellY = getCellY(vertices[v].y() - vertexTolerance); cellY <= getCellY(vertices[v].y() + vertexTolerance); ++cellY)
+        {
+            cellReferences.push_back({getCellKey(cellX, cellY), v});
+        }
+    }
+    for (size_t h = 0; h < numHalfEdges; h += 2)
+    {
+        size_t upward = vertices[origins[h]].y() < vertices[origins[h + 1]].y() ? h : h + 1;
+        const auto &lower = vertices[origins[upward]];
+        const auto &upper = vertices[arrangement.getTarget(upward)];
+        if (upper.y() - lower.y() <= 2. * vertexTolerance)
+        {
+            continue;
+        }
+        for (size_t cellY = getCellY(lower.y()); cellY <= getCellY(upper.y()); ++cellY)
+        {
+            // The part of the edge within the row, widened by the tolerance against rounding.
+            double rowMinY = std::max(lower.y(), gridMinY + cellY * cellSize - vertexTolerance);
+            double rowMaxY = cellY + 1 == numCellsY ? upper.y() : std::min(upper.y(), gridMinY + (cellY + 1) * cellSize + vertexTolerance);
+            double xAtRowMin = lower.x() + (rowMinY - lower.y()) / (upper.y() - lower.y()) * (upper.x() - lower.x());
+            double xAtRowMax = lower.x() + (rowMaxY - lower.y()) / (upper.y() - lower.y()) * (upper.x() - lower.x());
+            size_t cellXEnd = getCellX(std::max(xAtRowMin, xAtRowMax) + vertexTolerance);
+            for (size_t cellX = getCellX(std::min(xAtRowMin, xAtRowMax) - vertexTolerance); cellX <= cellXEnd; ++cellX)
+            {
+                cellReferences.push_back({getCellKey(cellX, cellY), vertices.size() + upward / 2});
+            }
+        }
+    }
+    std::sort(cellReferences.begin(), cellReferences.end());
+
+    std::vector<uint64_t> cellKeys;
+    std::vector<size_t> cellOffsets;
+    for (size_t r = 0; r < cellReferences.size(); ++r)
+    {
+        if (r == 0 || cellReferences[r].first != cellReferences[r - 1].first)
+        {
+            cellKeys.push_back(cellReferences[r].first);
+            cellOffsets.push_back(r);
+        }
+    }
+    cellOffsets.push_back(cellReferences.size());
+
+    std::vector<size_t> containingCycles(numCycles, NoIndex);
+    for (size_t c = 0; c < numCycles; ++c)
+    {
+        if (cycleFaces[c] != NoIndex)
+        {
+            continue;
+        }
+
+        size_t leftmost = arrangement.halfEdgeOrigins[cycleHalfEdges[c]];
+        for (size_t vertex : arrangement.getBoundaryVertices(cycleHalfEdges[c]))
+        {
+            if (std::tie(vertices[vertex].m_x, vertices[vertex].m_y) < std::tie(vertices[leftmost].m_x, vertices[leftmost].m_y))
+            {
+                leftmost = vertex;
+            }
+        }
+        const auto &rayOrigin = vertices[leftmost];
+
+        // Among equally near hits, vertices take precedence over edges, and lower indices over higher ones.
+        double nearestHitX = -std::numeric_limits<double>::infinity();
+        size_t nearestItem = NoIndex;
+        size_t hitCycle = NoIndex;
+        size_t rowKey = getCellKey(0, getCellY(rayOrigin.y()));
+        for (auto cell = std::upper_bound(cellKeys.begin(), cellKeys.end(), getCellKey(getCellX(rayOrigin.x()), getCellY(rayOrigin.y())));
+             cell != cellKeys.begin() && *(cell - 1) >= rowKey; --cell)
+        {
+            size_t cellIdx = cell - 1 - cellKeys.begin();
+            double cellMinX = gridMinX + (*(cell - 1) - rowKey) * cellSize;
+            // Hits in cells further left are further away, up to rounding in the cell coordinates.
+            if (nearestItem != NoIndex && nearestHitX > cellMinX + vertexTolerance)
+            {
+                break;
+            }
+
+            for (size_t r = cellOffsets[cellIdx]; r < cellOffsets[cellIdx + 1]; ++r)
+            {
+                size_t item = cellReferences[r].second;
+                if (item < vertices.size())
+                {
+                    const auto &vertex = vertices[item];
+                    if (std::abs(vertex.y() - rayOrigin.y()) <= vertexTolerance && vertex.x() < rayOrigin.x() - vertexTolerance
+                        && (vertex.x() > nearestHitX || (vertex.x() == nearestHitX && item < nearestItem)))
+                    {
+                        nearestHitX = vertex.x();
+                        nearestItem = item;
+                        hitCycle = getCycleAtVertexFacingEast(item);
+                    }
+                    continue;
+                }
+
+                // The downward half-edge has the part of the plane to its right (looking along the ray) on its
+                // left. Edges ending within the tolerance band are handled as vertex hits.
+                size_t downward = 2 * (item - vertices.size());
+                if (vertices[origins[downward]].y() < vertices[origins[downward + 1]].y())
+                {
+                    ++downward;
+                }
+                const auto &origin = vertices[origins[downward]];
+                const auto &target = vertices[arrangement.getTarget(downward)];
+                if (origin.y() <= rayOrigin.y() + vertexTolerance || target.y() >= rayOrigin.y() - vertexTolerance)
+                {
+                    continue;
+                }
+                double t = (rayOrigin.y() - origin.y()) / (target.y() - origin.y());
+                double hitX = origin.x() + t * (target.x() - origin.x());
+                if (hitX < rayOrigin.x() && (hitX > nearestHitX || (hitX == nearestHitX && item < nearestItem)))
+                {
+                    nearestHitX = hitX;
+                    nearestItem = item;
+                    hitCycle = halfEdgeCycles[downward];
+                }
+            }
+        }
+        containingCycles[c] = hitCycle;
+    }
+
+    // Each chain of containing hole cycles is followed once, assigning its face to all cycles along it.
+    std::vector<size_t> chain;
+    for (size_t c = 0; c < numCycles; ++c)
+    {
+        size_t curr = c;
+        while (cycleFaces[curr] == NoIndex && containingCycles[curr] != NoIndex)
+        {
+            chain.push_back(curr);
+            curr = containingCycles[curr];
+        }
+        size_t face = cycleFaces[curr] == NoIndex ? 0 : cycleFaces[curr];
+        cycleFaces[curr] = face;
+        for (size_t cycle : chain)
+        {
+            cycleFaces[cycle] = face;
+        }
+        chain.clear();
+    }
+
+    // 6. Face records.
+    arrangement.halfEdgeFaces.resize(numHalfEdges);
+    for (size_t h = 0; h < numHalfEdges; ++h)
+    {
+        arrangement.halfEdgeFaces[h] = cycleFaces[halfEdgeCycles[h]];
+    }
+
+    size_t numFaces = arrangement.getNumFaces();
+    arrangement.faceHoleOffsets.assign(numFaces + 1, 0);
+    for (size_t c = 0; c < numCycles; ++c)
+    {
+        if (arrangement.faceOuterHalfEdges[cycleFaces[c]] != cycleHalfEdges[c])
+        {
+            ++arrangement.faceHoleOffsets[cycleFaces[c] + 1];
+        }
+    }
+    for (size_t f = 0; f < numFaces; ++f)
+    {
+        arrangement.faceHoleOffsets[f + 1] += arrangement.faceHoleOffsets[f];
+    }
+    arrangement.faceHoleHalfEdges.resize(arrangement.faceHoleOffsets.back());
+    auto fillPositions = arrangement.faceHoleOffsets;
+    for (size_t c = 0; c < numCycles; ++c)
+    {
+        if (arrangement.faceOuterHalfEdges[cycleFaces[c]] != cycleHalfEdges[c])
+        {
+            arrangement.faceHoleHalfEdges[fillPositions[cycleFaces[c]]++] = cycleHalfEdges[c];
+        }
+    }
+
+    return arrangement;
+}
+
+} // namespace algorithms
@@ -0,0 +1,70 @@
+#ifndef ARRANGEMENT_HPP_INCLUDED
+#define ARRANGEMENT_HPP_INCLUDED
+
+#include <limits>
+#include <vector>
+
+#include "primitives/linesegment.hpp"
+
+namespace algorithms
+{
+
+constexpr size_t NoHalfEdge = std::numeric_limits<size_t>::max();
+
+// Planar arrangement of a set of line segments as a doubly-connected edge list, stored in flat arrays.
+//
+// The line segments are split in all their intersection points, and overlapping parts of several
+// line segments become a single edge. Edge e consists of the two half-edges 2 * e and 2 * e + 1,
+// so the twin of half-edge h is h ^ 1. Every half-edge has the face it bounds on its left, and
+// halfEdgeNext/halfEdgePrev walk along the boundary of that face, counterclockwise for outer
+// boundaries and clockwise for the boundaries of holes.
+//
+// Face 0 is the unbounded face. Every other face has exactly one outer boundary, and any face
+// may have holes, i. e., connected components of the arrangement lying inside it.
+struct Arrangement
+{
+    std::vector<primitives::Point> vertices;
+    // One half-edge starting in each vertex.
+    std::vector<size_t> vertexHalfEdges;
+
+    std::vector<size_t> halfEdgeOrigins;
+    std::vector<size_t> halfEdgeNext;
+    std::vector<size_t> halfEdgePrev;
+    std::vector<size_t> halfEdgeFaces;
+
+    // The input line segments each edge lies on: edgeSegments[edgeSegmentOffsets[e]] to
+    // edgeSegments[edgeSegmentOffsets[e + 1] - 1], in increasing order.
+    std::vector<size_t> edgeSegmentOffsets;
+    std::vector<size_t> edgeSegments;
+
+    // A half-edge on the outer boundary of each face, NoHalfEdge for the unbounded face.
+    std::vector<size_t> faceOuterHalfEdges;
+    // One half-edge on the boundary of each hole of face f: faceHoleHalfEdges[faceHoleOffsets[f]]
+    // to faceHoleHalfEdges[faceHoleOffsets[f + 1] - 1].
+    std::vector<size_t> faceHoleOffsets;
+    std::vector<size_t> faceHoleHalfEdges;
+
+    size_t getNumHalfEdges() const { return halfEdgeOrigins.size(); }
+    size_t getNumEdges() const { return halfEdgeOrigins.size() / 2; }
+    size_t getNumFaces() const { return faceOuterHalfEdges.size(); }
+
+    static size_t getTwin(size_t halfEdge) { return halfEdge ^ 1; }
+    size_t getTarget(size_t halfEdge) const { return halfEdgeOrigins[getTwin(halfEdge)]; }
+
+    // The vertices along the boundary cycle containing <halfEdge>, starting at its origin.
+    std::vector<size_t> getBoundaryVertices(size_t halfEdge) const;
+    // Signed area enclosed by the boundary cycle containing <halfEdge>; positive for outer
+    // boundaries of bounded faces.
+    double getBoundaryArea(size_t halfEdge) const;
+    // Area of a bounded face, i. e., the area inside its outer boundary minus the area of its holes.
+    double getFaceArea(size_t face) const;
+};
+
+// Builds the arrangement of <segments>, finding their intersections on <numThreads> threads
+// (0 meaning all hardware threads). End and intersection points closer than 1e-6 are merged
+// into a single vertex.
+Arrangement computeArrangement(const std::vector<primitives::LineSegment>& segments, size_t numThreads = 0);
+
+} // namespace algorithms
+
+#endif
@@ -0,0 +1,440 @@
+#include "algorithms/planesweep/booleans.hpp"
+
+#include <algorithm>
+#include <array>
+#include <cmath>
+#include <limits>
+#include <queue>
+#include <stdexcept>
+#include <unordered_map>
+
+#include "algorithms/planesweep/arrangement.hpp"
+#include "utility/disjointsets.hpp"
+
+namespace algorithms
+{
+
+namespace
+{
+
+constexpr size_t NoIndex = std::numeric_limits<size_t>::max();
+
+// Edges of both operands, each with the side its polygon covers.
+struct BooleanInput
+{
+    void addPolygon(const primitives::PolygonWithHoles &polygon, size_t operand)
+    {
+        addBoundary(polygon.outer, operand, true);
+        for (const auto &hole : polygon.holes)
+        {
+            addBoundary(hole, operand, false);
+        }
+    }
+
+    // Orients every boundary such that the winding number is increased by one inside outer
+    // boundaries and decreased by one inside holes.
+    void addBoundary(const primitives::Polygon &boundary, size_t operand, bool isOuter)
+    {
+        bool isInteriorLeft = (boundary.getSignedArea() > 0.) == isOuter;
+        for (size_t i = 0; i < boundary.size(); ++i)
+        {
+            segments.push_back(boundary.getEdge(i));
+            segmentOperands.push_back(operand);
+            segmentIsInteriorLeft.push_back(isInteriorLeft);
+        }
+    }
+
+    // Adds a closed ring which may intersect itself, as given, i. e., counterclockwise loops increase the
+    // winding number. Vertices closer than the minimum length of a LineSegment are merged first.
+    void addRing(const std::vector<primitives::Point> &ring, size_t operand)
+    {
+        std::vector<primitives::Point> vertices;
+        for (const auto &vertex : ring)
+        {
+            if (vertices.empty() || vertices.back().squareDistance(vertex) >= 1e-6)
+            {
+                vertices.push_back(vertex);
+            }
+        }
+        while (vertices.size() > 1 && vertices.back().squareDistance(vertices.front()) < 1e-6)
+        {
+            vertices.pop_back();
+        }
+        if (vertices.size() < 2)
+        {
+            return;
+        }
+
+        for (size_t i = 0; i < vertices.size(); ++i)
+        {
+            segments.emplace_back(vertices[i], vertices[(i + 1) % vertices.size()]);
+            segmentOperands.push_back(operand);
+            segmentIsInteriorLeft.push_back(true);
+        }
+    }
+
+    std::vector<primitives::LineSegment> segments;
+    std::vector<size_t> segmentOperands;
+    std::vector<bool> segmentIsInteriorLeft;
+};
+
+struct BoundingBox
+{
+    double minX = std::numeric_limits<double>::max();
+    double minY = std::numeric_limits<double>::max();
+    double maxX = std::numeric_limits<double>::lowest();
+    double maxY = std::numeric_limits<double>::lowest();
+
+    void add(const primitives::Polygon &polygon)
+    {
+        for (size_t i = 0; i < polygon.size(); ++i)
+        {
+            auto vertex = polygon.getVertex(i);
+            minX = std::min(minX, vertex.x());
+            minY = std::min(minY, vertex.y());
+            maxX = std::max(maxX, vertex.x());
+            maxY = std::max(maxY, vertex.y());
+        }
+    }
+
+    bool overlaps(const BoundingBox &other) const
+    {
+        return minX <= other.maxX && other.minX <= maxX && minY <= other.maxY && other.minY <= maxY;
+    }
+};
+
+BoundingBox getBoundingBox(const std::vector<primitives::PolygonWithHoles> &polygons)
+{
+    BoundingBox boundingBox;
+    for (const auto &polygon : polygons)
+    {
+        boundingBox.add(polygon.outer);
+    }
+    return boundingBox;
+}
+
+bool isCovered(int windingNumber)
+{
+    return windingNumber != 0;
+}
+
+bool applyOperation(BooleanOperation operation, bool isInFirst, bool isInSecond)
+{
+    switch (operation)
+    {
+    case BooleanOperation::Union:
+        return isInFirst || isInSecond;
+    case BooleanOperation::Intersection:
+        return isInFirst && isInSecond;
+    case BooleanOperation::Difference:
+        return isInFirst && !isInSecond;
+    case BooleanOperation::SymmetricDifference:
+        return isInFirst != isInSecond;
+    }
+    return false;
+}
+
+// Winding numbers of both operands per face. Crossing half-edge h from its right to its left side changes
+// the winding number of an operand by the number of its boundaries along h having their interior on the
+// left minus those having it on the right. Starting with 0 in the unbounded face, the winding numbers are
+// propagated through the faces in breadth-first order.
+std::vector<std::array<int, 2>> computeFaceWindingNumbers(const Arrangement &arrangement, const BooleanInput &input)
+{
+    std::vector<std::array<int, 2>> halfEdgeWindingSteps(arrangement.getNumHalfEdges(), {0, 0});
+    for (size_t e = 0; e < arrangement.getNumEdges(); ++e)
+    {
+        size_t halfEdge = 2 * e;
+        const auto &origin = arrangement.vertices[arrangement.halfEdgeOrigins[halfEdge]];
+        const auto &target = arrangement.vertices[arrangement.getTarget(halfEdge)];
+        for (size_t i = arrangement.edgeSegmentOffsets[e]; i < arrangement.edgeSegmentOffsets[e + 1]; ++i)
+        {
+            size_t segment = arrangement.edgeSegments[i];
+            const auto &segmentStart = input.segments[segment].getStartPoint();
+            const auto &segmentEnd = input.segments[segment].getEndPoint();
+            bool isAlongSegment = (target.x() - origin.x()) * (segmentEnd.x() - segmentStart.x())
+                                  + (target.y() - origin.y()) * (segmentEnd.y() - segmentStart.y()) > 0.;
+            int step = isAlongSegment == input.segmentIsInteriorLeft[segment] ? 1 : -1;
+            halfEdgeWindingSteps[halfEdge][input.segmentOperands[segment]] += step;
+            halfEdgeWindingSteps[Arrangement::getTwin(halfEdge)][input.segmentOperands[segment]] -= step;
+        }
+    }
+
+    std::vector<std::array<int, 2>> faceWindingNumbers(arrangement.getNumFaces(), {0, 0});
+    std::vector<bool> isVisited(arrangement.getNumFaces(), false);
+    std::queue<size_t> faces;
+    isVisited[0] = true;
+    faces.push(0);
+
+    auto visitBoundary = [&](size_t face, size_t startHalfEdge)
+    {
+        size_t halfEdge = startHalfEdge;
+        do
+        {
+            size_t twin = Arrangement::getTwin(halfEdge);
+            size_t neighbour = arrangement.halfEdgeFaces[twin];
+            if (!isVisited[neighbour])
+            {
+                isVisited[neighbour] = true;
+                for (size_t operand = 0; operand < 2; ++operand)
+                {
+                    faceWindingNumbers[neighbour][operand] =
+                        faceWindingNumbers[face][operand] + halfEdgeWindingSteps[twin][operand];
+                }
+                faces.push(neighbour);
+            }
+            halfEdge = arrangement.halfEdgeNext[halfEdge];
+        } while (halfEdge != startHalfEdge);
+    };
+
+    while (!faces.empty())
+    {
+        size_t face = faces.front();
+        faces.pop();
+        if (arrangement.faceOuterHalfEdges[face] != NoHalfEdge)
+        {
+            visitBoundary(face, arrangement.faceOuterHalfEdges[face]);
+        }
+        for (size_t i = arrangement.faceHoleOffsets[face]; i < arrangement.faceHoleOffsets[face + 1]; ++i)
+        {
+            visitBoundary(face, arrangement.faceHoleHalfEdges[i]);
+        }
+    }
+
+    return faceWindingNumbers;
+}
+
+// Merges vertices closer than the minimum length of a LineSegment, and drops vertices in the middle of
+// straight edges, which come from edges of the other operand ending there.
+std::vector<primitives::Point> cleanUpBoundary(const std::vector<primitives::Point> &vertices)
+{
+    std::vector<primitives::Point> separated;
+    for (const auto &vertex : vertices)
+    {
+        if (separated.empty() || separated.back().squareDistance(vertex) >= 1e-6)
+        {
+            separated.push_back(vertex);
+        }
+    }
+    while (separated.size() > 1 && separated.back().squareDistance(separated.front()) < 1e-6)
+    {
+        separated.pop_back();
+    }
+
+    std::vector<primitives::Point> result;
+    for (size_t i = 0; i < separated.size(); ++i)
+    {
+        const auto &prev = separated[(i + separated.size() - 1) % separated.size()];
+        const auto &curr = separated[i];
+        const auto &next = separated[(i + 1) % separated.size()];
+        double inX = curr.x() - prev.x();
+        double inY = curr.y() - prev.y();
+        double outX = next.x() - curr.x();
+        double outY = next.y() - curr.y();
+        double cross = inX * outY - inY * outX;
+        double dot = inX * outX + inY * outY;
+        if (dot > 0. && std::abs(cross) <= 1e-9 * std::sqrt((inX * inX + inY * inY) * (outX * outX + outY * outY)))
+        {
+            continue;
+        }
+        result.push_back(curr);
+    }
+    return result;
+}
+
+// Where the result touches itself in a vertex, e. g. in a hole touching the outer boundary, the walk along its
+// boundary passes that vertex twice. Cutting out the loop in between separates the outer boundary from the hole.
+std::vector<std::vector<size_t>> splitAtRepeatedVertices(const std::vector<size_t> &boundary)
+{
+    std::vector<std::vector<size_t>> loops;
+    std::vector<size_t> remaining;
+    std::unordered_map<size_t, size_t> remainingPositions;
+    for (size_t vertex : boundary)
+    {
+        auto position = remainingPositions.find(vertex);
+        if (position == remainingPositions.end())
+        {
+            remainingPositions[vertex] = remaining.size();
+            remaining.push_back(vertex);
+            continue;
+        }
+
+        auto loopBegin = remaining.begin() + position->second;
+        loops.emplace_back(loopBegin, remaining.end());
+        for (auto it = loopBegin + 1; it != remaining.end(); ++it)
+        {
+            remainingPositions.erase(*it);
+        }
+        remaining.erase(loopBegin + 1, remaining.end());
+    }
+    loops.push_back(std::move(remaining));
+
+    return loops;
+}
+
+// Boundaries of the union of the faces in the result, grouped into polygons with holes.
+std::vector<primitives::PolygonWithHoles> extractRegions(const Arrangement &arrangement, const std::vector<bool> &isInResult)
+{
+    // Faces of the result which are connected through edges form one polygon.
+    utility::DisjointSets regions(arrangement.getNumFaces());
+    auto isResultBoundary = [&](size_t halfEdge)
+    {
+        return isInResult[arrangement.halfEdgeFaces[halfEdge]]
+               && !isInResult[arrangement.halfEdgeFaces[Arrangement::getTwin(halfEdge)]];
+    };
+    for (size_t e = 0; e < arrangement.getNumEdges(); ++e)
+    {
+        size_t leftFace = arrangement.halfEdgeFaces[2 * e];
+        size_t rightFace = arrangement.halfEdgeFaces[2 * e + 1];
+        if (isInResult[leftFace] && isInResult[rightFace])
+        {
+            regions.unite(leftFace, rightFace);
+        }
+    }
+
+    // Walks along the boundary of the result with the result on the left, turning at every vertex into the
+    // first boundary half-edge found by rotating through the faces of the result.
+    std::vector<primitives::PolygonWithHoles> result;
+    std::vector<size_t> regionPolygons(arrangement.getNumFaces(), NoIndex);
+    std::vector<std::pair<size_t, primitives::Polygon>> holes;
+    std::vector<bool> isWalked(arrangement.getNumHalfEdges(), false);
+    for (size_t h = 0; h < arrangement.getNumHalfEdges(); ++h)
+    {
+        if (isWalked[h] || !isResultBoundary(h))
+        {
+            continue;
+        }
+
+        std::vector<size_t> boundary;
+        size_t curr = h;
+        do
+        {
+            isWalked[curr] = true;
+            boundary.push_back(arrangement.halfEdgeOrigins[curr]);
+
+            curr = arrangement.halfEdgeNext[curr];
+            while (!isResultBoundary(curr))
+            {
+                curr = arrangement.halfEdgeNext[Arrangement::getTwin(curr)];
+            }
+        } while (curr != h);
+
+        size_t region = regions.find(arrangement.halfEdgeFaces[h]);
+        for (const auto &loop : splitAtRepeatedVertices(boundary))
+        {
+            std::vector<primitives::Point> vertices;
+            double doubleArea = 0.;
+            for (size_t i = 0; i < loop.size(); ++i)
+            {
+                const auto &vertex = arrangement.vertices[loop[i]];
+                const auto &nextVertex = arrangement.vertices[loop[(i + 1) % loop.size()]];
+                vertices.push_back(vertex);
+                doubleArea += vertex.x() * nextVertex.y() - nextVertex.x() * vertex.y();
+            }
+
+            vertices = cleanUpBoundary(vertices);
+            if (vertices.size() < 3)
+            {
+                continue;
+            }
+
+            if (doubleArea > 0.)
+            {
+                regionPolygons[region] = result.size();
+                result.push_back({primitives::Polygon(vertices), {}});
+            }
+            else
+            {
+                holes.emplace_back(region, primitives::Polygon(vertices));
+            }
+        }
+    }
+
+    for (auto &[region, hole] : holes)
+    {
+        if (regionPolygons[region] == NoIndex)
+        {
+            throw std::logic_error("Found hole outside of every polygon of the result.");
+        }
+        result[regionPolygons[region]].holes.push_back(std::move(hole));
+    }
+
+    return result;
+}
+
+} // namespace
+
+std::vector<primitives::PolygonWithHoles> computeBooleanOperation(const std::vector<primitives::PolygonWithHoles> &first,
+                                                                  const std::vector<primitives::PolygonWithHoles> &second,
+                                                                  BooleanOperation operation,
+                                                                  size_t numThreads)
+{
+    // Clipping against far away masks is common enough to skip building the arrangement.
+    if (operation == BooleanOperation::Intersection && !getBoundingBox(first).overlaps(getBoundingBox(second)))
+    {
+        return {};
+    }
+
+    BooleanInput input;
+    for (const auto &polygon : first)
+    {
+        input.addPolygon(polygon, 0);
+    }
+    for (const auto &polygon : second)
+    {
+        input.addPolygon(polygon, 1);
+    }
+
+    auto arrangement = computeArrangement(input.segments, numThreads);
+    auto faceWindingNumbers = computeFaceWindingNumbers(arrangement, input);
+
+    std::vector<bool> isInResult(arrangement.getNumFaces());
+    for (size_t f = 0; f < arrangement.getNumFaces(); ++f)
+    {
+        isInResult[f] = applyOperation(operation, isCovered(faceWindingNumbers[f][0]), isCovered(faceWindingNumbers[f][1]));
+    }
+
+    return extractRegions(arrangement, isInResult);
+}
+
+std::vector<primitives::PolygonWithHoles> computeBooleanOperation(const std::vector<primitives::Polygon> &first,
+                                                                  const std::vector<primitives::Polygon> &second,
+                                                                  BooleanOperation operation,
+                                                                  size_t numThreads)
+{
+    auto withoutHoles = [](const std::vector<primitives::Polygon> &polygons)
+    {
+        std::vector<primitives::PolygonWithHoles> result;
+        result.reserve(polygons.size());
+        for (const auto &polygon : polygons)
+        {
+            result.push_back({polygon, {}});
+        }
+        return result;
+    };
+    return computeBooleanOperation(withoutHoles(first), withoutHoles(second), operation, numThreads);
+}
+
+std::vector<primitives::PolygonWithHoles> computeFilledRegion(const std::vector<std::vector<primitives::Point>> &rings,
+                                                              FillRule fillRule,
+                                                              size_t numThreads)
+{
+    BooleanInput input;
+    for (const auto &ring : rings)
+    {
+        input.addRing(ring, 0);
+    }
+
+    auto arrangement = computeArrangement(input.segments, numThreads);
+    auto faceWindingNumbers = computeFaceWindingNumbers(arrangement, input);
+
+    std::vector<bool> isInResult(arrangement.getNumFaces());
+    for (size_t f = 0; f < arrangement.getNumFaces(); ++f)
+    {
+        int windingNumber = faceWindingNumbers[f][0];
+        isInResult[f] = fillRule == FillRule::Positive ? windingNumber > 0 : isCovered(windingNumber);
+    }
+
+    return extractRegions(arrangement, isInResult);
+}
+
+} // namespace algorithms
@@ -0,0 +1,53 @@
+#ifndef BOOLEANS_HPP_INCLUDED
+#define BOOLEANS_HPP_INCLUDED
+
+#include <vector>
+
+#include "primitives/polygon.hpp"
+
+namespace algorithms
+{
+
+enum class BooleanOperation
+{
+    Union,
+    Intersection,
+    // The first operand minus the second one.
+    Difference,
+    SymmetricDifference
+};
+
+// Computes the region covered by <operation> applied to two polygon sets. Each set covers every point
+// with a nonzero winding number, so its polygons may overlap and may be oriented either way; the holes
+// of a PolygonWithHoles are cut out of its own outer boundary only.
+//
+// The result consists of pairwise disjoint polygons with counterclockwise outer boundaries and
+// clockwise holes, without vertices in the middle of straight edges. Touching in single points
+// doesn't join two regions. numThreads = 0 means as many threads as the hardware has.
+std::vector<primitives::PolygonWithHoles> computeBooleanOperation(const std::vector<primitives::PolygonWithHoles>& first,
+                                                                  const std::vector<primitives::PolygonWithHoles>& second,
+                                                                  BooleanOperation operation,
+                                                                  size_t numThreads = 0);
+
+std::vector<primitives::PolygonWithHoles> computeBooleanOperation(const std::vector<primitives::Polygon>& first,
+                                                                  const std::vector<primitives::Polygon>& second,
+                                                                  BooleanOperation operation,
+                                                                  size_t numThreads = 0);
+
+// Which points the closed rings passed to computeFilledRegion cover, by their winding number.
+enum class FillRule
+{
+    NonZero,
+    Positive
+};
+
+// Region covered by closed rings, which may intersect themselves and each other, with the result in the same form
+// as for computeBooleanOperation. Vertices closer than the minimum length of a LineSegment are merged. This is what
+// resolves the self-intersections of raw offset curves when buffering.
+std::vector<primitives::PolygonWithHoles> computeFilledRegion(const std::vector<std::vector<primitives::Point>>& rings,
+                                                              FillRule fillRule,
+                                                              size_t numThreads = 0);
+
+} // namespace algorithms
+
+#endif
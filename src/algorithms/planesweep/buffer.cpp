@@ -0,0 +1,300 @@
+#include "algorithms/planesweep/buffer.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <stdexcept>
+
+#include "algorithms/planesweep/booleans.hpp"
+#include "algorithms/simplification/simplification.hpp"
+
+namespace algorithms
+{
+
+namespace
+{
+
+const double pi = std::acos(-1.);
+
+// Largest distance allowed between the buffer and its exact shape.
+double getTolerance(double distance, const BufferStyle& style)
+{
+    return style.arcTolerance > 0. ? style.arcTolerance : std::abs(distance) / 100.;
+}
+
+// Drops the vertices which Douglas-Peucker simplification with <tolerance> drops. Where the offset of a
+// bend collapses, the raw offset curve folds over itself with every offset edge crossing most of the others,
+// so this bounds the number of self-intersections by the shape instead of by how finely it is sampled.
+std::vector<primitives::Point> thinOut(const std::vector<primitives::Point>& vertices, bool isRing, double tolerance)
+{
+    auto importances = rankVertices(vertices, isRing, SimplificationMethod::DouglasPeucker);
+    std::vector<primitives::Point> thinnedOut;
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        if (importances[i] > tolerance)
+        {
+            thinnedOut.push_back(vertices[i]);
+        }
+    }
+    return thinnedOut;
+}
+
+// Builds the raw offset curve of a closed vertex sequence, moving every edge by distance to its right, which is
+// the outside of counterclockwise rings. Vertices marked as caps are where a polyline turns back on itself.
+struct RawOffsetCurve
+{
+    RawOffsetCurve(double distance, const BufferStyle& style)
+        : m_distance(distance)
+        , m_style(style)
+    {
+        double radius = std::abs(distance);
+        m_arcStepAngle = 2. * std::acos(1. - std::min(getTolerance(distance, style) / 2. / radius, 1.));
+    }
+
+    std::vector<primitives::Point> build(const std::vector<primitives::Point>& vertices, const std::vector<bool>& isCap)
+    {
+        m_curve.clear();
+        size_t size = vertices.size();
+        for (size_t i = 0; i < size; ++i)
+        {
+            const auto& prev = vertices[(i + size - 1) % size];
+            const auto& curr = vertices[i];
+            const auto& next = vertices[(i + 1) % size];
+            auto incoming = getDirection(prev, curr);
+            auto outgoing = getDirection(curr, next);
+
+            // Ends of the offset edges before and after the vertex.
+            primitives::Point before(curr.x() + m_distance * incoming.y(), curr.y() - m_distance * incoming.x());
+            primitives::Point after(curr.x() + m_distance * outgoing.y(), curr.y() - m_distance * outgoing.x());
+
+            if (isCap[i])
+            {
+                addCap(curr, incoming, before, after);
+                continue;
+            }
+
+            double cross = incoming.x() * outgoing.y() - incoming.y() * outgoing.x();
+            double dot = incoming.x() * outgoing.x() + incoming.y() * outgoing.y();
+            if (cross * m_distance > 0.)
+            {
+                addJoin(curr, incoming, outgoing, before, after, std::atan2(cross, dot));
+            }
+            else if (std::abs(m_distance * cross) < (1. + dot) * std::min(prev.distance(curr), curr.distance(next)) / 2.)
+            {
+                // The offset edges intersect within the halves next to the vertex, closer than
+                // |distance| * tan(turnAngle / 2) to it.
+                m_curve.push_back(getIntersection(curr, incoming, outgoing));
+            }
+            else
+            {
+                // The offset edges overlap. Going through the vertex makes the overlap a loop with
+                // nonpositive winding number, which drops out of the buffer.
+                m_curve.push_back(before);
+                if (before.squareDistance(after) >= 1e-6)
+                {
+                    m_curve.push_back(curr);
+                    m_curve.push_back(after);
+                }
+            }
+        }
+        return m_curve;
+    }
+
+private:
+    static primitives::Point getDirection(const primitives::Point& from, const primitives::Point& to)
+    {
+        double length = from.distance(to);
+        return primitives::Point((to.x() - from.x()) / length, (to.y() - from.y()) / length);
+    }
+
+    // Intersection of the offset lines of the edges before and after <vertex>.
+    primitives::Point getIntersection(const primitives::Point& vertex, const primitives::Point& incoming, const primitives::Point& outgoing) const
+    {
+        double scale = m_distance / (1. + incoming.x() * outgoing.x() + incoming.y() * outgoing.y());
+        return primitives::Point(vertex.x() + scale * (incoming.y() + outgoing.y()), vertex.y() - scale * (incoming.x() + outgoing.x()));
+    }
+
+    // Arc around <center> from <from> to <to>, turning by <angle> (counterclockwise if positive).
+    void addArc(const primitives::Point& center, const primitives::Point& from, const primitives::Point& to, double angle)
+    {
+        double radius = std::abs(m_distance);
+        double startAngle = std::atan2(from.y() - center.y(), from.x() - center.x());
+        size_t numSteps = std::max<size_t>(1, static_cast<size_t>(std::ceil(std::abs(angle) / m_arcStepAngle)));
+        m_curve.push_back(from);
+        for (size_t step = 1; step < numSteps; ++step)
+        {
+            double stepAngle = startAngle + angle * step / numSteps;
+            m_curve.emplace_back(center.x() + radius * std::cos(stepAngle), center.y() + radius * std::sin(stepAngle));
+        }
+        m_curve.push_back(to);
+    }
+
+    // Cuts the corner between the offset edges through <before> and <after> perpendicular to the bisector, at
+    // <cutDistance> from the vertex.
+    void addSquaredCorner(const primitives::Point& vertex,
+                          const primitives::Point& incoming,
+                          const primitives::Point& outgoing,
+                          const primitives::Point& before,
+                          const primitives::Point& after,
+                          double cutDistance)
+    {
+        double bisectorX = before.x() + after.x() - 2. * vertex.x();
+        double bisectorY = before.y() + after.y() - 2. * vertex.y();
+        double bisectorLength = std::sqrt(bisectorX * bisectorX + bisectorY * bisectorY);
+        bisectorX /= bisectorLength;
+        bisectorY /= bisectorLength;
+
+        auto getCutPoint = [&](const primitives::Point& start, const primitives::Point& direction)
+        {
+            double startDistance = (start.x() - vertex.x()) * bisectorX + (start.y() - vertex.y()) * bisectorY;
+            double param = (cutDistance - startDistance) / (direction.x() * bisectorX + direction.y() * bisectorY);
+            return primitives::Point(start.x() + param * direction.x(), start.y() + param * direction.y());
+        };
+        m_curve.push_back(before);
+        m_curve.push_back(getCutPoint(before, incoming));
+        m_curve.push_back(getCutPoint(after, outgoing));
+        m_curve.push_back(after);
+    }
+
+    void addJoin(const primitives::Point& vertex,
+                 const primitives::Point& incoming,
+                 const primitives::Point& outgoing,
+                 const primitives::Point& before,
+                 const primitives::Point& after,
+                 double turnAngle)
+    {
+        double radius = std::abs(m_distance);
+        switch (m_style.joinType)
+        {
+        case JoinType::Round:
+            addArc(vertex, before, after, turnAngle);
+            return;
+        case JoinType::Square:
+            addSquaredCorner(vertex, incoming, outgoing, before, after, radius);
+            return;
+        case JoinType::Mitre:
+        {
+            // The offset edges meet at radius / cos(turnAngle / 2) from the vertex.
+            double mitreFactor = 1. / std::cos(turnAngle / 2.);
+            if (mitreFactor > m_style.mitreLimit)
+            {
+                addSquaredCorner(vertex, incoming, outgoing, before, after, m_style.mitreLimit * radius);
+                return;
+            }
+            m_curve.push_back(getIntersection(vertex, incoming, outgoing));
+            return;
+        }
+        }
+    }
+
+    void addCap(const primitives::Point& vertex, const primitives::Point& incoming, const primitives::Point& before, const primitives::Point& after)
+    {
+        switch (m_style.endCap)
+        {
+        case EndCap::Butt:
+            m_curve.push_back(before);
+            m_curve.push_back(after);
+            return;
+        case EndCap::Round:
+            addArc(vertex, before, after, pi);
+            return;
+        case EndCap::Square:
+            m_curve.emplace_back(before.x() + m_distance * incoming.x(), before.y() + m_distance * incoming.y());
+            m_curve.emplace_back(after.x() + m_distance * incoming.x(), after.y() + m_distance * incoming.y());
+            return;
+        }
+    }
+
+    double m_distance;
+    BufferStyle m_style;
+    double m_arcStepAngle;
+    std::vector<primitives::Point> m_curve;
+};
+
+// Vertices of <ring> in counterclockwise order if <isCounterclockwise> is set, clockwise otherwise.
+std::vector<primitives::Point> getOrientedVertices(const primitives::Polygon& ring, bool isCounterclockwise)
+{
+    std::vector<primitives::Point> vertices;
+    vertices.reserve(ring.size());
+    for (size_t i = 0; i < ring.size(); ++i)
+    {
+        vertices.push_back(ring.getVertex(i));
+    }
+    if ((ring.getSignedArea() > 0.) != isCounterclockwise)
+    {
+        std::reverse(vertices.begin(), vertices.end());
+    }
+    return vertices;
+}
+
+} // namespace
+
+std::vector<primitives::PolygonWithHoles> bufferPolygon(const primitives::PolygonWithHoles& polygon,
+                                                        double distance,
+                                                        const BufferStyle& style,
+                                                        size_t numThreads)
+{
+    // With the outer boundary counterclockwise and the holes clockwise, the outside of the polygon is on the
+    // right of every ring.
+    std::vector<std::vector<primitives::Point>> rings = {getOrientedVertices(polygon.outer, true)};
+    for (const auto& hole : polygon.holes)
+    {
+        rings.push_back(getOrientedVertices(hole, false));
+    }
+
+    if (distance != 0.)
+    {
+        RawOffsetCurve rawOffsetCurve(distance, style);
+        for (auto& ring : rings)
+        {
+            ring = thinOut(ring, true, getTolerance(distance, style) / 2.);
+            ring = rawOffsetCurve.build(ring, std::vector<bool>(ring.size(), false));
+        }
+    }
+    return computeFilledRegion(rings, FillRule::Positive, numThreads);
+}
+
+std::vector<primitives::PolygonWithHoles> bufferPolygon(const primitives::Polygon& polygon,
+                                                        double distance,
+                                                        const BufferStyle& style,
+                                                        size_t numThreads)
+{
+    return bufferPolygon(primitives::PolygonWithHoles{polygon, {}}, distance, style, numThreads);
+}
+
+std::vector<primitives::PolygonWithHoles> bufferPolyline(const std::vector<primitives::Point>& polyline,
+                                                         double distance,
+                                                         const BufferStyle& style,
+                                                         size_t numThreads)
+{
+    if (distance <= 0.)
+    {
+        throw std::invalid_argument("Buffer distance of polyline must be positive.");
+    }
+
+    // Walks forward along the polyline and back again, which keeps the right side of the walk outside, with caps
+    // where it turns around.
+    std::vector<primitives::Point> points;
+    for (const auto& point : polyline)
+    {
+        if (points.empty() || points.back().squareDistance(point) >= 1e-6)
+        {
+            points.push_back(point);
+        }
+    }
+    if (points.size() < 2)
+    {
+        throw std::invalid_argument("Polyline needs at least two distinct points.");
+    }
+
+    points = thinOut(points, false, getTolerance(distance, style) / 2.);
+    std::vector<primitives::Point> walk = points;
+    walk.insert(walk.end(), points.rbegin() + 1, points.rend() - 1);
+    std::vector<bool> isCap(walk.size(), false);
+    isCap[0] = true;
+    isCap[points.size() - 1] = true;
+
+    RawOffsetCurve rawOffsetCurve(distance, style);
+    return computeFilledRegion({rawOffsetCurve.build(walk, isCap)}, FillRule::Positive, numThreads);
+}
+
+} // namespace algorithms
@@ -0,0 +1,77 @@
+#ifndef BUFFER_HPP_INCLUDED
+#define BUFFER_HPP_INCLUDED
+
+#include <vector>
+
+#include "primitives/point.hpp"
+#include "primitives/polygon.hpp"
+
+namespace algorithms
+{
+
+// Shape of the offset boundary around vertices where the offset edges leave a gap.
+enum class JoinType
+{
+    // Extends both offset edges to where they meet, squared off beyond BufferStyle::mitreLimit.
+    Mitre,
+    // Circular arc around the vertex.
+    Round,
+    // Squared off at the offset distance from the vertex.
+    Square
+};
+
+// Shape of the buffer around the end points of a polyline.
+enum class EndCap
+{
+    // Cut off at the end point.
+    Butt,
+    // Half circle around the end point.
+    Round,
+    // Extended by the offset distance beyond the end point.
+    Square
+};
+
+struct BufferStyle
+{
+    JoinType joinType = JoinType::Round;
+    EndCap endCap = EndCap::Round;
+    // Mitre joins reaching farther than mitreLimit times the offset distance from their vertex are squared off
+    // at that distance.
+    double mitreLimit = 2.;
+    // Largest distance between the buffer and its exact shape, split evenly between ignoring vertices of the
+    // input and approximating round joins and caps. 0 means a hundredth of the offset distance.
+    double arcTolerance = 0.;
+};
+
+// Offsets the boundary of a polygon outward by <distance>, or inward if <distance> is negative.
+//
+// Vertices which Douglas-Peucker simplification within half the arc tolerance drops are ignored first. Then
+// every edge is moved by the distance to the outside, the gaps between neighbouring edges are closed by joins and
+// overlapping ones are connected through their vertex. Where the resulting raw curve intersects itself, e. g.
+// where the outward offset of a bay or the inward offset of a narrow part collapses, the loops left over don't
+// have a positive winding number, so the buffer is the region with positive winding number, computed with
+// computeFilledRegion. For n vertices, the raw curve has O(n) edges, so this costs as much as computeFilledRegion
+// on O(n) edges with k intersections, k being the number of self-intersections of the raw curve.
+// As for computeBooleanOperation, features of the result smaller than about 1e-3 are not resolved.
+//
+// The result is in the same form as that of computeBooleanOperation. It may consist of several polygons, e. g. if
+// an inward offset splits the polygon, or none at all.
+std::vector<primitives::PolygonWithHoles> bufferPolygon(const primitives::PolygonWithHoles& polygon,
+                                                        double distance,
+                                                        const BufferStyle& style = {},
+                                                        size_t numThreads = 0);
+std::vector<primitives::PolygonWithHoles> bufferPolygon(const primitives::Polygon& polygon,
+                                                        double distance,
+                                                        const BufferStyle& style = {},
+                                                        size_t numThreads = 0);
+
+// Region within <distance> of a polyline, with end caps at both of its ends. The polyline may intersect itself.
+// Throws std::invalid_argument if the distance isn't positive or the polyline has less than two distinct points.
+std::vector<primitives::PolygonWithHoles> bufferPolyline(const std::vector<primitives::Point>& polyline,
+                                                         double distance,
+                                                         const BufferStyle& style = {},
+                                                         size_t numThreads = 0);
+
+} // namespace algorithms
+
+#endif
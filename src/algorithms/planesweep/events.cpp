@@ -1,76 +1,95 @@
 #include "algorithms/planesweep/events.hpp"
 
+#include <algorithm>
 #include <cmath>
-#include <glm/geometric.hpp>
 
 namespace algorithms
 {
 
-bool Event::operator<(const Event& otherEvent)
+Event::Event(const primitives::LineSegment& line, size_t lineIdx, bool isUpper)
+    : m_eventType(EventType::EndPoint), m_firstLineIdx(lineIdx), m_isUpper(isUpper)
 {
-    auto thisPosition = this->getPosition();
-    auto otherPosition = otherEvent.getPosition();
-
-    if (thisPosition.squareDistance(otherPosition) < 1e-6)
-    {
-        // In case of two events happening at the same position, e. g., an intersection
-        // in a lower end point event, we want to make sure the intersection event is processed first.
-        // Otherwise the line whose end point is intersected will have been removed from the status line
-        // by the time the intersection event is processed.
-        return this->getType() < otherEvent.getType();
-    }
-
-    return thisPosition < otherPosition;
+    bool isStartPointUpper = line.getStartPoint() < line.getEndPoint();
+    m_position = isStartPointUpper == isUpper ? line.getStartPoint() : line.getEndPoint();
 }
 
-IntersectionEvent::IntersectionEvent(primitives::LineSegment line, primitives::LineSegment otherLine)
+Event::Event(const primitives::LineSegment& firstLine, size_t firstLineIdx,
+             const primitives::LineSegment& secondLine, size_t secondLineIdx)
+    : m_eventType(EventType::Intersection), m_firstLineIdx(firstLineIdx), m_secondLineIdx(secondLineIdx)
 {
-    if (!line.intersects(otherLine))
-    {
-        throw std::logic_error("Trying to create intersection event with non-intersecting lines.");
-    }
+    m_intersection = firstLine.computeIntersection(secondLine);
 
-    m_firstLine = line;
-    m_secondLine = otherLine;
-    m_intersection = m_firstLine.computeIntersection(m_secondLine);
-    m_eventType = EventType::Intersection;
-}
-
-primitives::Point IntersectionEvent::getPosition() const
-{
     if (std::holds_alternative<std::monostate>(m_intersection))
     {
-        throw std::logic_error("IntersectionEvent contains empty intersection. This shouldn't happen.");
+        throw std::logic_error("Trying to create intersection event with non-intersecting lines.");
     }
 
     if (std::holds_alternative<primitives::Point>(m_intersection))
     {
-        return std::get<primitives::Point>(m_intersection);
+        m_position = std::get<primitives::Point>(m_intersection);
+        return;
     }
 
     auto intersectionLine = std::get<primitives::LineSegment>(m_intersection);
 
     // Probably not correct. TODO: Figure out better solution.
-    return intersectionLine.getStartPoint() < intersectionLine.getEndPoint() 
-           ? intersectionLine.getStartPoint() 
-           : intersectionLine.getEndPoint();
+    m_position = intersectionLine.getStartPoint() < intersectionLine.getEndPoint() 
+                 ? intersectionLine.getStartPoint() 
+                 : intersectionLine.getEndPoint();
 }
 
-bool IntersectionEvent::operator==(const IntersectionEvent& otherIntersectionEvent)
+bool Event::isSameIntersection(const Event& otherEvent) const
 {
-    return (getFirstLine() == otherIntersectionEvent.getFirstLine() && getSecondLine() == otherIntersectionEvent.getSecondLine())
-           || (getFirstLine() == otherIntersectionEvent.getSecondLine() && getSecondLine() == otherIntersectionEvent.getFirstLine());
+    return m_eventType == EventType::Intersection && otherEvent.m_eventType == EventType::Intersection
+           && ((m_firstLineIdx == otherEvent.m_firstLineIdx && m_secondLineIdx == otherEvent.m_secondLineIdx)
+               || (m_firstLineIdx == otherEvent.m_secondLineIdx && m_secondLineIdx == otherEvent.m_firstLineIdx));
 }
 
-
-primitives::Point EndPointEvent::getPosition() const
+bool Event::operator<(const Event& otherEvent) const
 {
-    if (m_isUpper)
+    if (m_position.squareDistance(otherEvent.m_position) < 1e-6)
     {
-        return m_line.getStartPoint() < m_line.getEndPoint() ? m_line.getStartPoint() : m_line.getEndPoint();
+        // In case of two events happening at the same position, e. g., an intersection
+        // in a lower end point event, we want to make sure the intersection event is processed first.
+        // Otherwise the line whose end point is intersected will have been removed from the status line
+        // by the time the intersection event is processed.
+        return m_eventType < otherEvent.m_eventType;
     }
 
-    return m_line.getStartPoint() < m_line.getEndPoint() ? m_line.getEndPoint() : m_line.getStartPoint();
+    return m_position < otherEvent.m_position;
+}
+
+bool EventQueue::isPoppedLater(const QueuedEvent& lhs, const QueuedEvent& rhs)
+{
+    if (rhs.event < lhs.event) return true;
+    if (lhs.event < rhs.event) return false;
+
+    return lhs.sequenceNumber > rhs.sequenceNumber;
+}
+
+void EventQueue::push(Event event)
+{
+    m_heap.push_back({std::move(event), m_nextSequenceNumber++});
+    std::push_heap(m_heap.begin(), m_heap.end(), isPoppedLater);
+}
+
+void EventQueue::pop()
+{
+    std::pop_heap(m_heap.begin(), m_heap.end(), isPoppedLater);
+    m_heap.pop_back();
+}
+
+std::vector<Event> EventQueue::getSortedEvents() const
+{
+    auto heapCopy = m_heap;
+    std::sort_heap(heapCopy.begin(), heapCopy.end(), isPoppedLater);
+
+    std::vector<Event> events;
+    for (auto it = heapCopy.rbegin(); it != heapCopy.rend(); ++it)
+    {
+        events.push_back(it->event);
+    }
+    return events;
 }
 
 } //namespace algorithms
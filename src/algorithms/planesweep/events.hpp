@@ -3,71 +3,86 @@
 
 #include "primitives/linesegment.hpp"
 
+#include <vector>
+
 namespace algorithms
 {
 
 enum EventType
 {
-    Base,
     Intersection,
     EndPoint
 };
 
-// Abstract base class to be implemented by IntersectionEvent and EndPointEvent.
-// We need this base class to have a common comparison operator for all types of events
-// and to be able to store all types of events in a single sorted container; the status line.
+// All events of the sweep are plain values of this single type, so that they can be stored by value in the
+// event queue and be compared without any virtual calls or casts. Events refer to lines by their index
+// in the line vector of the sweep.
+//
+// We compare events by comparing their positions, which are computed once on construction.
+// For end point events their position is simply the position of the end point in question
+// (based on whether it's an upper or lower end point event),
+// for intersection events it is of course the position of the intersection point.
+// If the lines intersect in another line, it is not immediately obvious what its position is.
+// for the time being we use the smallest end point.
 struct Event
 {
-    virtual ~Event() {};
-
-    // We compare events by comparing their positions.
-    // For end point events their position is simply the position of the end point in question
-    // (based on whether it's an upper or lower end point event),
-    // for intersection events it is of course the position of the intersection point.
-    // If the lines intersect in another line, it is not immediately obvious what its position is.
-    // for the time being we use the smallest end point.
-    virtual primitives::Point getPosition() const = 0;
+    // End point event of the line with index <lineIdx>.
+    Event(const primitives::LineSegment& line, size_t lineIdx, bool isUpper);
+    // Intersection event of two lines. Throws if the lines don't intersect.
+    Event(const primitives::LineSegment& firstLine, size_t firstLineIdx,
+          const primitives::LineSegment& secondLine, size_t secondLineIdx);
 
     EventType getType() const { return m_eventType; }
+    const primitives::Point& getPosition() const { return m_position; }
 
-    bool operator<(const Event& otherEvent);
-
-protected:
-    EventType m_eventType = EventType::Base;
-};
-
-struct IntersectionEvent: public Event
-{
-    IntersectionEvent(primitives::LineSegment line, primitives::LineSegment otherLine);
-
-    const primitives::LineSegment& getFirstLine() const { return m_firstLine; }
-    const primitives::LineSegment& getSecondLine() const { return m_secondLine; }
-
-    primitives::LineLineIntersection getIntersection() const { return m_intersection; };
+    // For end point events the line index, for intersection events the index of the first line.
+    size_t getFirstLineIdx() const { return m_firstLineIdx; }
+    size_t getSecondLineIdx() const { return m_secondLineIdx; }
+    bool isUpperEndPoint() const { return m_isUpper; }
+    const primitives::LineLineIntersection& getIntersection() const { return m_intersection; }
 
-    primitives::Point getPosition() const override;
+    // Whether both events are intersection events of the same two lines.
+    bool isSameIntersection(const Event& otherEvent) const;
 
-    bool operator==(const IntersectionEvent& otherIntersectionEvent);
+    bool operator<(const Event& otherEvent) const;
 
 private:
-    primitives::LineSegment m_firstLine;
-    primitives::LineSegment m_secondLine;
+    EventType m_eventType;
+    primitives::Point m_position;
+    size_t m_firstLineIdx;
+    size_t m_secondLineIdx = 0;
+    bool m_isUpper = false;
     primitives::LineLineIntersection m_intersection;
 };
 
-struct EndPointEvent: public Event
+// Priority queue of events, smallest event first, kept as a binary heap in a single buffer which is reused
+// for all pushes and pops, so that queueing an event doesn't allocate (once the buffer has grown large enough).
+// Events comparing equal are popped in the order they were pushed.
+struct EventQueue
 {
-    EndPointEvent(primitives::LineSegment line, bool isUpper) : m_line(line), m_isUpper(isUpper) { m_eventType = EventType::EndPoint; }
+    void reserve(size_t capacity) { m_heap.reserve(capacity); }
 
-    const primitives::LineSegment& getLine() const { return m_line; }
+    bool empty() const { return m_heap.empty(); }
+    size_t size() const { return m_heap.size(); }
 
-    primitives::Point getPosition() const override;
+    const Event& top() const { return m_heap.front().event; }
+    void push(Event event);
+    void pop();
 
-    bool isUpperEndPoint() const { return m_isUpper; }
+    // All queued events in sorted order. Meant for debugging only, since it copies the queue.
+    std::vector<Event> getSortedEvents() const;
 
 private:
-    bool m_isUpper;
-    primitives::LineSegment m_line;
+    struct QueuedEvent
+    {
+        Event event;
+        size_t sequenceNumber;
+    };
+
+    static bool isPoppedLater(const QueuedEvent& lhs, const QueuedEvent& rhs);
+
+    std::vector<QueuedEvent> m_heap;
+    size_t m_nextSequenceNumber = 0;
 };
 
 } // namespace algorithms
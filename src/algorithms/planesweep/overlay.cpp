@@ -0,0 +1,110 @@
+#include "algorithms/planesweep/overlay.hpp"
+
+#include "utility/disjointsets.hpp"
+
+namespace algorithms
+{
+
+namespace
+{
+
+// The polygon an input line segment is an edge of.
+struct SegmentSource
+{
+    size_t subdivision;
+    size_t polygon;
+    // Whether the interior of the polygon lies to the left of the line segment.
+    bool isInteriorLeft;
+};
+
+// Every face bordering a polygon edge from the inside gets that polygon directly. The polygon is the same on
+// both sides of every edge which is no polygon edge of this subdivision, so these are merged, and each group of
+// merged faces takes the polygon assigned to any of its faces.
+std::vector<size_t> getFacePolygons(const Arrangement &arrangement,
+                                    const std::vector<primitives::LineSegment> &segments,
+                                    const std::vector<SegmentSource> &sources,
+                                    size_t subdivision)
+{
+    size_t numFaces = arrangement.getNumFaces();
+    utility::DisjointSets faceGroups(numFaces);
+    std::vector<size_t> facePolygons(numFaces, NoPolygon);
+
+    for (size_t e = 0; e < arrangement.getNumEdges(); ++e)
+    {
+        size_t halfEdge = 2 * e;
+        const auto &origin = arrangement.vertices[arrangement.halfEdgeOrigins[halfEdge]];
+        const auto &target = arrangement.vertices[arrangement.getTarget(halfEdge)];
+
+        bool isPolygonEdge = false;
+        for (size_t i = arrangement.edgeSegmentOffsets[e]; i < arrangement.edgeSegmentOffsets[e + 1]; ++i)
+        {
+            size_t segment = arrangement.edgeSegments[i];
+            const auto &source = sources[segment];
+            if (source.subdivision != subdivision)
+            {
+                continue;
+            }
+            isPolygonEdge = true;
+
+            const auto &segmentStart = segments[segment].getStartPoint();
+            const auto &segmentEnd = segments[segment].getEndPoint();
+            bool isAlongSegment = (target.x() - origin.x()) * (segmentEnd.x() - segmentStart.x())
+                                  + (target.y() - origin.y()) * (segmentEnd.y() - segmentStart.y()) > 0.;
+            size_t insideHalfEdge = isAlongSegment == source.isInteriorLeft ? halfEdge : Arrangement::getTwin(halfEdge);
+            facePolygons[arrangement.halfEdgeFaces[insideHalfEdge]] = source.polygon;
+        }
+
+        if (!isPolygonEdge)
+        {
+            faceGroups.unite(arrangement.halfEdgeFaces[halfEdge], arrangement.halfEdgeFaces[Arrangement::getTwin(halfEdge)]);
+        }
+    }
+
+    std::vector<size_t> groupPolygons(numFaces, NoPolygon);
+    for (size_t f = 0; f < numFaces; ++f)
+    {
+        if (facePolygons[f] != NoPolygon)
+        {
+            groupPolygons[faceGroups.find(f)] = facePolygons[f];
+        }
+    }
+    for (size_t f = 0; f < numFaces; ++f)
+    {
+        facePolygons[f] = groupPolygons[faceGroups.find(f)];
+    }
+
+    return facePolygons;
+}
+
+} // namespace
+
+Overlay computeOverlay(const std::vector<primitives::Polygon> &firstPolygons,
+                       const std::vector<primitives::Polygon> &secondPolygons,
+                       size_t numThreads)
+{
+    std::vector<primitives::LineSegment> segments;
+    std::vector<SegmentSource> sources;
+    auto addEdges = [&segments, &sources](const std::vector<primitives::Polygon> &polygons, size_t subdivision)
+    {
+        for (size_t p = 0; p < polygons.size(); ++p)
+        {
+            bool isCounterClockwise = polygons[p].getSignedArea() > 0.;
+            for (size_t i = 0; i < polygons[p].size(); ++i)
+            {
+                segments.push_back(polygons[p].getEdge(i));
+                sources.push_back({subdivision, p, isCounterClockwise});
+            }
+        }
+    };
+    addEdges(firstPolygons, 0);
+    addEdges(secondPolygons, 1);
+
+    Overlay overlay;
+    overlay.arrangement = computeArrangement(segments, numThreads);
+    overlay.firstFacePolygons = getFacePolygons(overlay.arrangement, segments, sources, 0);
+    overlay.secondFacePolygons = getFacePolygons(overlay.arrangement, segments, sources, 1);
+
+    return overlay;
+}
+
+} // namespace algorithms
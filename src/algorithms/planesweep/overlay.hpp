@@ -0,0 +1,36 @@
+#ifndef OVERLAY_HPP_INCLUDED
+#define OVERLAY_HPP_INCLUDED
+
+#include <limits>
+#include <vector>
+
+#include "algorithms/planesweep/arrangement.hpp"
+#include "primitives/polygon.hpp"
+
+namespace algorithms
+{
+
+constexpr size_t NoPolygon = std::numeric_limits<size_t>::max();
+
+// Overlay of two planar subdivisions, each given as a set of polygons with pairwise disjoint interiors
+// (e. g. zoning areas and parcels). The result is the arrangement of all polygon edges, where each face
+// records which polygon of either subdivision it lies in.
+struct Overlay
+{
+    Arrangement arrangement;
+    // Per face of the arrangement the index of the polygon of the first resp. second subdivision
+    // containing it, or NoPolygon if it is not covered by that subdivision.
+    std::vector<size_t> firstFacePolygons;
+    std::vector<size_t> secondFacePolygons;
+};
+
+// Computes the overlay of <firstPolygons> and <secondPolygons>, which may be oriented either way.
+// Polygons of the same subdivision may share edges and vertices, but their interiors must not overlap.
+// numThreads = 0 means as many threads as the hardware has.
+Overlay computeOverlay(const std::vector<primitives::Polygon>& firstPolygons,
+                       const std::vector<primitives::Polygon>& secondPolygons,
+                       size_t numThreads = 0);
+
+} // namespace algorithms
+
+#endif
@@ -1,60 +1,64 @@
 #include "planesweep.hpp"
 
 #include <algorithm>
+#include <cmath>
+#include <limits>
 #include <set>
-#include <memory>
+#include <tuple>
 
 #include <iostream>
 
 #include "algorithms/planesweep/events.hpp"
+#include "utility/io.hpp"
+#include "utility/parallel.hpp"
 
 namespace algorithms
 {
 
-    double getComparisonValue(const primitives::LineLineIntersection &intersection)
+    // Status line entry. Lines are compared by the x-values of their intersections with
+    // the status line. Any entry will hold the position of the status line at the time
+    // when it was inserted into it in its compareLine variable. Since the status line
+    // moves from top to bottom the min of the two entries' compareLine values is used to
+    // compare them, as this is presumably the current position of the status line.
+    // The x-value at a given y is evaluated in closed form from a point on the line and its
+    // inverse slope, both of which are computed once on construction, so comparisons
+    // neither allocate nor compute any trigonometric functions. Outside the y-range of the
+    // line the x-value is extrapolated along the supporting line.
+    struct ComparableLineSegment
     {
-        if (std::holds_alternative<std::monostate>(intersection))
+        ComparableLineSegment(const primitives::LineSegment &line, size_t lineIdx, double currY) : lineIdx(lineIdx), compareLine(currY)
         {
-            throw std::logic_error("Trying to get comparison point from empty intersection.");
-        }
-
-        if (std::holds_alternative<primitives::Point>(intersection))
-        {
-            return std::get<primitives::Point>(intersection).x();
-        }
-
-        throw std::logic_error("Non-fudged horizontal lines in comparison, which shouldn't happen.");
-    }
+            double startY = line.getStartPoint().y();
+            double endY = line.getEndPoint().y();
 
-    // Wrapper class around LineSegment to implement comparison of lines when inserting
-    // in status line. Lines are compared by comparing the x-values of their intersections
-    // with the status line. Any LineSegment will hold the position of the status line
-    // at the time when they were inserted into it in their compareLine variable.
-    // Since the status line moved from top to bottom the min of the two lines compareLine
-    // values is used to compare them, as this is presumably the current position of the
-    // status line.
-    struct ComparableLineSegment : public primitives::LineSegment
-    {
-        ComparableLineSegment(const primitives::LineSegment &line, double currY) : primitives::LineSegment(line), compareLine(currY)
-        {
             // Horizontal lines are difficult to compare because they will not intersect a given comparison ray
-            // in a unique point. So they are slightly fudged to make them comparable.
-            if (std::abs(getStartPoint().y() - getEndPoint().y()) < 2 * 1e-5)
+            // in a unique point. So they are slightly fudged to make them comparable. Lines which are only
+            // slightly sloped keep their direction, otherwise their position would flip between their end points.
+            // Horizontal ones are tilted down to the right, whichever way they point, as their left end point
+            // is the upper one in the event queue.
+            if (std::abs(startY - endY) < 2 * 1e-5)
             {
-                fudgeEndPoints();
+                bool isStartUpper = std::abs(startY - endY) < 1e-6 ? line.getStartPoint().x() < line.getEndPoint().x() : startY > endY;
+                double fudge = isStartUpper ? 1e-5 : -1e-5;
+                startY += fudge;
+                endY -= fudge;
             }
+
+            m_anchorX = line.getStartPoint().x();
+            m_anchorY = startY;
+            m_inverseSlope = (line.getEndPoint().x() - m_anchorX) / (endY - startY);
+        }
+
+        double getXAt(double y) const
+        {
+            return m_anchorX + (y - m_anchorY) * m_inverseSlope;
         }
 
         bool operator<(const ComparableLineSegment &otherLine) const
         {
             double minCompareLine = std::min(compareLine, otherLine.compareLine);
-            std::vector<double> xValues = {getStartPoint().x(), getEndPoint().x(), otherLine.getStartPoint().x(), otherLine.getEndPoint().x()};
-            double xmin = *std::min_element(xValues.begin(), xValues.end());
-            double xmax = *std::max_element(xValues.begin(), xValues.end());
-            primitives::LineSegment horizontalLineAtCurrY(primitives::Point(xmin - 1., minCompareLine), primitives::Point(xmax + 1., minCompareLine));
-
-            auto thisComparisonValue = getComparisonValue(computeIntersection(horizontalLineAtCurrY));
-            auto otherComparisonValue = getComparisonValue(otherLine.computeIntersection(horizontalLineAtCurrY));
+            double thisComparisonValue = getXAt(minCompareLine);
+            double otherComparisonValue = otherLine.getXAt(minCompareLine);
 
             if (std::abs(thisComparisonValue - otherComparisonValue) < 1e-8)
             {
@@ -66,40 +70,107 @@ namespace algorithms
             return thisComparisonValue < otherComparisonValue;
         }
 
-        void fudgeEndPoints()
+        size_t lineIdx;
+        double compareLine;
+
+    private:
+        double m_anchorX;
+        double m_anchorY;
+        double m_inverseSlope;
+    };
+
+    // Everything the event handlers below need to share while the sweep is running.
+    struct SweepState
+    {
+        SweepState(const std::vector<primitives::LineSegment> &lines, const IntersectionCallback &onIntersection)
+            : lines(lines), onIntersection(onIntersection)
         {
-            if (hasBeenFudged)
-                return;
-            setStartPoint(primitives::Point(getStartPoint().x(), getStartPoint().y() + 1e-5));
-            setEndPoint(primitives::Point(getEndPoint().x(), getEndPoint().y() - 1e-5));
-            hasBeenFudged = true;
         }
 
-        void defudgeEndPoints()
-        {
-            if (!hasBeenFudged)
-                return;
+        const std::vector<primitives::LineSegment> &lines;
+        const IntersectionCallback &onIntersection;
+        EventQueue eventQueue;
+        std::set<ComparableLineSegment> statusLine;
+        // Intersection events processed at the current event position. The same intersection may have been
+        // queued more than once (e. g. when the two lines become adjacent again at the intersection point),
+        // so this is used to process each of them only once.
+        std::vector<Event> processedIntersections;
+        // Only set when detecting whether there is any intersection, see Planesweep::findAnyIntersection.
+        // In this case no intersection events are queued and the sweep stops once firstIntersection is set.
+        std::optional<SharedEndPoints> detectionMode;
+        std::optional<SegmentIntersection> firstIntersection;
+        // Whether a line was removed from the status line before its lower end point event, indexed by line, see
+        // processEndPointEvent. Grows on demand, since the lines of streaming sweeps grow during the sweep.
+        std::vector<bool> isRemovedEarly;
+        // Only set for red-blue sweeps, where lines [0, *numRedLines) are red and the rest are blue.
+        std::optional<size_t> numRedLines;
+        bool skipSameColourPairs = false;
+        // Only set for streaming sweeps, where lines holds the line segments currently crossing
+        // the sweep line in reusable slots, and this maps every slot to the index of its line in the file.
+        const std::vector<size_t> *fileLineIndices = nullptr;
+    };
 
-            setStartPoint(primitives::Point(getStartPoint().x(), getStartPoint().y() - 1e-5));
-            setEndPoint(primitives::Point(getEndPoint().x(), getEndPoint().y() + 1e-5));
-            hasBeenFudged = false;
-        }
+    bool isSameColour(const SweepState &state, size_t firstLineIdx, size_t secondLineIdx)
+    {
+        return state.numRedLines && (firstLineIdx < *state.numRedLines) == (secondLineIdx < *state.numRedLines);
+    }
 
-        double compareLine;
+    void reportIntersection(SweepState &state, const Event &event)
+    {
+        size_t firstIdx = event.getFirstLineIdx();
+        size_t secondIdx = event.getSecondLineIdx();
+        if (state.fileLineIndices)
+        {
+            state.onIntersection({(*state.fileLineIndices)[firstIdx], (*state.fileLineIndices)[secondIdx], event.getIntersection()});
+            return;
+        }
+        if (!state.numRedLines)
+        {
+            state.onIntersection({firstIdx, secondIdx, event.getIntersection()});
+            return;
+        }
 
-    private:
-        bool hasBeenFudged = false;
-    };
+        if (isSameColour(state, firstIdx, secondIdx))
+        {
+            return;
+        }
+        if (firstIdx > secondIdx)
+        {
+            std::swap(firstIdx, secondIdx);
+        }
+        state.onIntersection({firstIdx, secondIdx - *state.numRedLines, event.getIntersection()});
+    }
 
-    // Wrapper comparator to be able to use the Event comparison operator to
-    // compare Events pointers when inserting them into a sorted container.
-    struct EventComparator
+    bool isPermittedIntersection(const SweepState &state, const Event &intersectionEvent)
     {
-        bool operator()(const std::unique_ptr<Event>& lhs, const std::unique_ptr<Event>& rhs) const
+        if (*state.detectionMode == SharedEndPoints::Forbidden || !std::holds_alternative<primitives::Point>(intersectionEvent.getIntersection()))
         {
-            return *lhs < *rhs;
+            return false;
         }
-    };
+
+        size_t firstIdx = intersectionEvent.getFirstLineIdx();
+        size_t secondIdx = intersectionEvent.getSecondLineIdx();
+        if (*state.detectionMode == SharedEndPoints::AllowedBetweenConsecutive
+            && (firstIdx + 1) % state.lines.size() != secondIdx && (secondIdx + 1) % state.lines.size() != firstIdx)
+        {
+            return false;
+        }
+
+        const auto &point = std::get<primitives::Point>(intersectionEvent.getIntersection());
+        auto isEndPointOf = [&point](const primitives::LineSegment &line)
+        {
+            return point.squareDistance(line.getStartPoint()) < 1e-12 || point.squareDistance(line.getEndPoint()) < 1e-12;
+        };
+
+        return isEndPointOf(state.lines[firstIdx]) && isEndPointOf(state.lines[secondIdx]);
+    }
+
+    // Whether the lower end point of <line> is at <position>, up to the tolerance of the event queue.
+    bool isLowerEndPointAt(const primitives::LineSegment &line, const primitives::Point &position)
+    {
+        const auto &lowerEndPoint = line.getStartPoint() < line.getEndPoint() ? line.getEndPoint() : line.getStartPoint();
+        return lowerEndPoint.squareDistance(position) < 1e-6;
+    }
 
     Planesweep::Planesweep(const std::vector<primitives::LineSegment> &lines)
     {
@@ -109,57 +180,59 @@ namespace algorithms
         }
     }
 
-    // Allocates memory for IntersectionEvent and inserts pointer to new event into eventQueue.
-    // NB: Remember to deallocate when removing events from queue. Use eraseEventFromQueue below for memory safe removal.
-    void insertIntersectionEvent(std::multiset<std::unique_ptr<Event>, EventComparator> &eventQueue,
-                                 ComparableLineSegment firstLine,
-                                 ComparableLineSegment secondLine,
+    // Creates intersection event for the two lines and inserts it into the event queue,
+    // unless the intersection lies above the sweep line, i. e., has already been processed.
+    void insertIntersectionEvent(SweepState &state,
+                                 const ComparableLineSegment &firstLine,
+                                 const ComparableLineSegment &secondLine,
                                  double currSweepLinePosition)
     {
-        // Ensure that the actual unfudged lines are recorded.
-        firstLine.defudgeEndPoints();
-        secondLine.defudgeEndPoints();
-
-        std::unique_ptr<Event> newIntersectionEvent(new IntersectionEvent(firstLine, secondLine));
-
-        if (newIntersectionEvent->getPosition().y() > currSweepLinePosition)
+        if (state.skipSameColourPairs && isSameColour(state, firstLine.lineIdx, secondLine.lineIdx))
         {
-            // Intersection is above current sweep line, so has already been processed
             return;
         }
 
-        auto [it0, it1] = eventQueue.equal_range(newIntersectionEvent);
-        for (auto foundIt = it0; foundIt != it1; ++foundIt)
+        // Ensure that the actual unfudged lines are recorded.
+        Event newIntersectionEvent(state.lines[firstLine.lineIdx], firstLine.lineIdx,
+                                   state.lines[secondLine.lineIdx], secondLine.lineIdx);
+
+        if (state.detectionMode)
         {
-            if (*dynamic_cast<IntersectionEvent *>(foundIt->get()) == *dynamic_cast<IntersectionEvent *>(newIntersectionEvent.get()))
+            // Any pair of lines found to intersect is a valid witness, so there is no need to
+            // queue the event and maintain the order of the status line past it.
+            if (!state.firstIntersection && !isPermittedIntersection(state, newIntersectionEvent))
             {
-                // Intersection event is alreay in event queue
-                return;
+                state.firstIntersection = SegmentIntersection{firstLine.lineIdx, secondLine.lineIdx, newIntersectionEvent.getIntersection()};
             }
+            return;
+        }
+
+        if (newIntersectionEvent.getPosition().y() > currSweepLinePosition)
+        {
+            // Intersection is above current sweep line, so has already been processed
+            return;
         }
 
-        eventQueue.insert(std::move(newIntersectionEvent));
+        state.eventQueue.push(std::move(newIntersectionEvent));
     }
 
     // Process intersection event:
-    //  1. Report Intersection to intersectionsOut.
+    //  1. Report Intersection to onIntersection.
     //  2. Swap the positions of the two intersecting lines in the status line.
     //  3. Check if the two lines intersect their new neighbors to the left resp. right
     //     in the status line and add intersection event to the event queue if so.
-    void processIntersectionEvent(std::multiset<std::unique_ptr<Event>, EventComparator> &eventQueue,
-                                  std::set<ComparableLineSegment> &statusLine,
-                                  std::vector<LinePair> &intersectionsOut,
-                                  const IntersectionEvent *event)
+    void processIntersectionEvent(SweepState &state, const Event &event)
     {
-        intersectionsOut.push_back(
-            {event->getFirstLine(), event->getSecondLine()});
+        const auto &firstLine = state.lines[event.getFirstLineIdx()];
+        const auto &secondLine = state.lines[event.getSecondLineIdx()];
+        reportIntersection(state, event);
 
-        double currSweepLinePosition = event->getPosition().y();
+        double currSweepLinePosition = event.getPosition().y();
 
-        double firstLineMaxY = std::max(event->getFirstLine().getStartPoint().y(), event->getFirstLine().getEndPoint().y());
-        double firstLineMinY = std::min(event->getFirstLine().getStartPoint().y(), event->getFirstLine().getEndPoint().y());
-        double secondLineMaxY = std::max(event->getSecondLine().getStartPoint().y(), event->getSecondLine().getEndPoint().y());
-        double secondLineMinY = std::min(event->getSecondLine().getStartPoint().y(), event->getSecondLine().getEndPoint().y());
+        double firstLineMaxY = std::max(firstLine.getStartPoint().y(), firstLine.getEndPoint().y());
+        double firstLineMinY = std::min(firstLine.getStartPoint().y(), firstLine.getEndPoint().y());
+        double secondLineMaxY = std::max(secondLine.getStartPoint().y(), secondLine.getEndPoint().y());
+        double secondLineMinY = std::min(secondLine.getStartPoint().y(), secondLine.getEndPoint().y());
 
         if (firstLineMaxY < currSweepLinePosition + 1e-5 || secondLineMaxY < currSweepLinePosition + 1e-5 || firstLineMinY > currSweepLinePosition - 1e-5 || secondLineMinY > currSweepLinePosition - 1e-5)
         {
@@ -168,8 +241,9 @@ namespace algorithms
             return;
         }
 
-        auto firstLinePos = statusLine.find(ComparableLineSegment(event->getFirstLine(), currSweepLinePosition + 1e-5));
-        auto secondLinePos = statusLine.find(ComparableLineSegment(event->getSecondLine(), currSweepLinePosition + 1e-5));
+        auto &statusLine = state.statusLine;
+        auto firstLinePos = statusLine.find(ComparableLineSegment(firstLine, event.getFirstLineIdx(), currSweepLinePosition + 1e-5));
+        auto secondLinePos = statusLine.find(ComparableLineSegment(secondLine, event.getSecondLineIdx(), currSweepLinePosition + 1e-5));
 
         if (firstLinePos == statusLine.end())
         {
@@ -193,23 +267,24 @@ namespace algorithms
         // a ray just *below* the intersection point. To this end, we fudge the comparison ray slightly down.
         // For minPos and maxPos to still correctly point to the lowest, resp. hightest, ordered line,
         // they must also be correctly reassigned.
-        ComparableLineSegment toInsert(*minPos, currSweepLinePosition - 1e-5);
+        ComparableLineSegment toInsert = *minPos;
+        toInsert.compareLine = currSweepLinePosition - 1e-5;
         minPos = statusLine.erase(minPos);
         maxPos = statusLine.insert(toInsert).first;
 
         // minNeighbor will be decremented below once it has been verified that this is valid,
         // i. e., that minPos is not first element.
         auto minNeighbor = minPos;
-        if (minPos != statusLine.begin() && minPos->intersects(*(--minNeighbor)))
+        if (minPos != statusLine.begin() && state.lines[minPos->lineIdx].intersects(state.lines[(--minNeighbor)->lineIdx]))
         {
-            insertIntersectionEvent(eventQueue, *minNeighbor, *minPos, currSweepLinePosition);
+            insertIntersectionEvent(state, *minNeighbor, *minPos, currSweepLinePosition);
         }
 
         // As above, maxNeighbor will be incremented once it has been verified that this is valid.
         auto maxNeighbor = maxPos;
-        if (++maxNeighbor != statusLine.end() && maxPos->intersects(*maxNeighbor))
+        if (++maxNeighbor != statusLine.end() && state.lines[maxPos->lineIdx].intersects(state.lines[maxNeighbor->lineIdx]))
         {
-            insertIntersectionEvent(eventQueue, *maxPos, *maxNeighbor, currSweepLinePosition);
+            insertIntersectionEvent(state, *maxPos, *maxNeighbor, currSweepLinePosition);
         }
     }
 
@@ -223,15 +298,16 @@ namespace algorithms
     //      2. Check whether the recently removed line's neighbors to the left resp. right
     //         (which are now adjacent) intersect and add intersection event to the event queue
     //         if this is the case.
-    void processEndPointEvent(std::multiset<std::unique_ptr<Event>, EventComparator> &eventQueue,
-                              std::set<ComparableLineSegment> &statusLine,
-                              std::vector<LinePair> &intersectionsOut,
-                              const EndPointEvent *event)
+    void processEndPointEvent(SweepState &state, const Event &event)
     {
-        if (event->isUpperEndPoint())
+        auto &statusLine = state.statusLine;
+        size_t lineIdx = event.getFirstLineIdx();
+        const auto &line = state.lines[lineIdx];
+        double currSweepLinePosition = event.getPosition().y();
+
+        if (event.isUpperEndPoint())
         {
-            double currSweepLinePosition = event->getPosition().y();
-            ComparableLineSegment toInsert(event->getLine(), currSweepLinePosition);
+            ComparableLineSegment toInsert(line, lineIdx, currSweepLinePosition);
             if (statusLine.find(toInsert) != statusLine.end())
             {
                 // If the line is intersected in its upper end point by
@@ -244,101 +320,405 @@ namespace algorithms
                 // TODO: Handle this!
                 toInsert.compareLine -= 1e-5;
             }
-            auto insertedIt = statusLine.insert(toInsert).first;
+            auto [insertedIt, isInserted] = statusLine.insert(toInsert);
+
+            // (Nearly) collinear lines, e. g. consecutive edges of a finely subdivided curve, may still
+            // compare equal below their shared point. If the line in the way ends here anyway, it is removed
+            // right away, once their intersection has been handled. Otherwise they are compared farther down
+            // until they separate. Dropping the line instead would lose it from the status line altogether.
+            if (!isInserted && isLowerEndPointAt(state.lines[insertedIt->lineIdx], event.getPosition()))
+            {
+                if (line.intersects(state.lines[insertedIt->lineIdx]))
+                {
+                    insertIntersectionEvent(state, *insertedIt, toInsert, currSweepLinePosition);
+                }
+                if (state.isRemovedEarly.size() < state.lines.size())
+                {
+                    state.isRemovedEarly.resize(state.lines.size());
+                }
+                state.isRemovedEarly[insertedIt->lineIdx] = true;
+                statusLine.erase(insertedIt);
+                std::tie(insertedIt, isInserted) = statusLine.insert(toInsert);
+            }
+            for (double offset = 2e-5; !isInserted && offset < 1e-3; offset *= 2)
+            {
+                toInsert.compareLine = currSweepLinePosition - offset;
+                std::tie(insertedIt, isInserted) = statusLine.insert(toInsert);
+            }
+            if (!isInserted)
+            {
+                throw std::logic_error("Upper end point event with line comparing equal to another line in status line.");
+            }
 
             // Will be properly incremented/decremented once verified that this is valid.
             auto leftNbr = insertedIt;
             auto rightNbr = insertedIt;
 
-            if (insertedIt != statusLine.begin() && insertedIt->intersects(*(--leftNbr)))
+            if (insertedIt != statusLine.begin() && line.intersects(state.lines[(--leftNbr)->lineIdx]))
             {
-                insertIntersectionEvent(eventQueue, *leftNbr, *insertedIt, currSweepLinePosition);
+                insertIntersectionEvent(state, *leftNbr, *insertedIt, currSweepLinePosition);
             }
 
-            if (++rightNbr != statusLine.end() && insertedIt->intersects(*rightNbr))
+            if (++rightNbr != statusLine.end() && line.intersects(state.lines[rightNbr->lineIdx]))
             {
-                insertIntersectionEvent(eventQueue, *insertedIt, *rightNbr, currSweepLinePosition);
+                insertIntersectionEvent(state, *insertedIt, *rightNbr, currSweepLinePosition);
             }
 
             return;
         }
 
         // Lower end point event.
-        auto currSweepLinePosition = event->getPosition().y();
-        auto itToDelete = statusLine.find(ComparableLineSegment(event->getLine(), currSweepLinePosition));
+        if (lineIdx < state.isRemovedEarly.size() && state.isRemovedEarly[lineIdx])
+        {
+            state.isRemovedEarly[lineIdx] = false;
+            return;
+        }
+        auto itToDelete = statusLine.find(ComparableLineSegment(line, lineIdx, currSweepLinePosition));
+        if (itToDelete == statusLine.end())
+        {
+            throw std::logic_error("Lower end point event with line not in status line.");
+        }
         auto rightNbr = statusLine.erase(itToDelete);
         auto leftNbr = rightNbr;
-        if (rightNbr != statusLine.end() && rightNbr != statusLine.begin() && (--leftNbr)->intersects(*rightNbr))
+        if (rightNbr != statusLine.end() && rightNbr != statusLine.begin() && state.lines[(--leftNbr)->lineIdx].intersects(state.lines[rightNbr->lineIdx]))
         {
-            insertIntersectionEvent(eventQueue, *leftNbr, *rightNbr, currSweepLinePosition);
+            insertIntersectionEvent(state, *leftNbr, *rightNbr, currSweepLinePosition);
         }
     }
 
-    void processNextEvent(std::multiset<std::unique_ptr<Event>, EventComparator> &eventQueue,
-                          std::set<ComparableLineSegment> &statusLine,
-                          std::vector<LinePair> &intersectionsOut)
+    void processAndPopNextEvent(SweepState &state)
     {
-        auto nextEvent = eventQueue.begin()->get();
+        // The event is copied out before popping it, since processing it pushes new events onto the queue.
+        Event nextEvent = state.eventQueue.top();
+        state.eventQueue.pop();
 
-        if (nextEvent->getType() == EventType::Intersection)
+        if (nextEvent.getType() == EventType::EndPoint)
         {
-            auto intersectionEvent = dynamic_cast<const IntersectionEvent *>(nextEvent);
-            processIntersectionEvent(eventQueue, statusLine, intersectionsOut, intersectionEvent);
-
+            processEndPointEvent(state, nextEvent);
             return;
         }
 
-        auto endPointEvent = dynamic_cast<EndPointEvent *>(nextEvent);
-        processEndPointEvent(eventQueue, statusLine, intersectionsOut, endPointEvent);
-    }
+        auto &processed = state.processedIntersections;
+        if (!processed.empty() && processed.back().getPosition().squareDistance(nextEvent.getPosition()) >= 1e-6)
+        {
+            processed.clear();
+        }
+        if (std::any_of(processed.begin(), processed.end(), [&nextEvent](const Event &event) { return event.isSameIntersection(nextEvent); }))
+        {
+            return;
+        }
+        processed.push_back(nextEvent);
 
-    void processAndPopNextEvent(std::multiset<std::unique_ptr<Event>, EventComparator> &eventQueue,
-                                std::set<ComparableLineSegment> &statusLine,
-                                std::vector<LinePair> &intersectionsOut)
-    {
-        auto nextEventIt = eventQueue.begin();
-        processNextEvent(eventQueue, statusLine, intersectionsOut);
-        eventQueue.erase(nextEventIt);
+        processIntersectionEvent(state, nextEvent);
     }
 
-    std::vector<LinePair> Planesweep::perform(bool printDebugInfo)
+    void runSweep(SweepState &state, bool printDebugInfo)
     {
-        std::multiset<std::unique_ptr<Event>, EventComparator> eventQueue;
+        const auto &lines = state.lines;
 
-        std::set<ComparableLineSegment> statusLine;
-        std::vector<LinePair> intersectionsOut;
-
-        for (size_t i = 0; i < m_lines.size(); ++i)
+        // Every line has two end point events, and there are typically a few intersection events queued at a time.
+        state.eventQueue.reserve(2 * lines.size() + 16);
+        for (size_t i = 0; i < lines.size(); ++i)
         {
-            // Insert EndPointEvent once for each end point with isUpper set resp. not set.
-            // The EndPointEvent will take care of returning the relevant end point for comparison
-            // based on whether it is upper or not.
-            eventQueue.insert(std::unique_ptr<Event>(new EndPointEvent(m_lines[i], true)));
-            eventQueue.insert(std::unique_ptr<Event>(new EndPointEvent(m_lines[i], false)));
+            // Insert end point event once for each end point with isUpper set resp. not set.
+            state.eventQueue.push(Event(lines[i], i, true));
+            state.eventQueue.push(Event(lines[i], i, false));
         }
 
-        while (!eventQueue.empty())
+        while (!state.eventQueue.empty() && !state.firstIntersection)
         {
             if (printDebugInfo)
             {
-                std::cout << "Processing event of type: " << (*eventQueue.begin())->getType() << std::endl;
+                std::cout << "Processing event of type: " << state.eventQueue.top().getType() << std::endl;
                 std::cout << "Status line: " << std::endl;
-                for (auto line : statusLine)
+                for (const auto &line : state.statusLine)
                 {
-                    std::cout << line << std::endl;
+                    std::cout << lines[line.lineIdx] << std::endl;
                 }
                 std::cout << "\nEvent Queue: " << std::endl;
-                for (auto &&event : eventQueue)
+                for (const auto &event : state.eventQueue.getSortedEvents())
                 {
-                    std::cout << "Type: " << event->getType() << " -- " << "Position: " << event->getPosition() << std::endl;
+                    std::cout << "Type: " << event.getType() << " -- " << "Position: " << event.getPosition() << std::endl;
                 }
                 std::cout << "-----------------------------------" << std::endl;
             }
 
-            processAndPopNextEvent(eventQueue, statusLine, intersectionsOut);
+            processAndPopNextEvent(state);
         }
+    }
 
+    void Planesweep::perform(const IntersectionCallback &onIntersection, bool printDebugInfo)
+    {
+        SweepState state(m_lines, onIntersection);
+        runSweep(state, printDebugInfo);
+    }
+
+    void Planesweep::perform(std::vector<SegmentIntersection> &intersectionsOut, bool printDebugInfo)
+    {
+        perform([&intersectionsOut](const SegmentIntersection &intersection)
+                { intersectionsOut.push_back(intersection); },
+                printDebugInfo);
+    }
+
+    std::vector<LinePair> Planesweep::perform(bool printDebugInfo)
+    {
+        std::vector<LinePair> intersectionsOut;
+        perform([this, &intersectionsOut](const SegmentIntersection &intersection)
+                { intersectionsOut.push_back({m_lines[intersection.firstSegment], m_lines[intersection.secondSegment]}); },
+                printDebugInfo);
         return intersectionsOut;
     }
 
+    // Part of <line> between the horizontal lines at y = bottom and y = top. If clipping would leave a
+    // degenerate line segment, the line is returned unclipped, so the result always covers the part of
+    // the line inside the slab.
+    primitives::LineSegment clipToSlab(const primitives::LineSegment &line, double bottom, double top)
+    {
+        auto upper = line.getStartPoint();
+        auto lower = line.getEndPoint();
+        if (upper.y() < lower.y())
+        {
+            std::swap(upper, lower);
+        }
+        if (upper.y() <= top && lower.y() >= bottom)
+        {
+            return line;
+        }
+
+        auto pointAtY = [&upper, &lower](double y)
+        {
+            double t = (y - lower.y()) / (upper.y() - lower.y());
+            return primitives::Point(lower.x() + t * (upper.x() - lower.x()), y);
+        };
+        auto clippedUpper = upper.y() > top ? pointAtY(top) : upper;
+        auto clippedLower = lower.y() < bottom ? pointAtY(bottom) : lower;
+        if (clippedUpper.squareDistance(clippedLower) < 1e-6)
+        {
+            return line;
+        }
+
+        return primitives::LineSegment(clippedUpper, clippedLower);
+    }
+
+    void Planesweep::performParallel(std::vector<SegmentIntersection> &intersectionsOut, size_t numThreads)
+    {
+        size_t numSlabs = std::min(utility::getNumThreads(numThreads), std::max<size_t>(1, m_lines.size() / 2));
+
+        // Slab boundaries at the quantiles of the end point y-values, in descending order. Slab s
+        // covers [boundaries[s], boundaries[s - 1]], where the outermost slabs extend to infinity.
+        std::vector<double> endPointYs;
+        endPointYs.reserve(2 * m_lines.size());
+        for (const auto &line : m_lines)
+        {
+            endPointYs.push_back(line.getStartPoint().y());
+            endPointYs.push_back(line.getEndPoint().y());
+        }
+        std::vector<double> boundaries;
+        for (size_t s = 1; s < numSlabs; ++s)
+        {
+            auto quantile = endPointYs.begin() + endPointYs.size() * s / numSlabs;
+            std::nth_element(endPointYs.begin(), quantile, endPointYs.end(), std::greater<double>());
+            boundaries.push_back(*quantile);
+        }
+        std::sort(boundaries.begin(), boundaries.end(), std::greater<double>());
+        boundaries.erase(std::unique(boundaries.begin(), boundaries.end()), boundaries.end());
+        numSlabs = boundaries.size() + 1;
+
+        auto getSlabTop = [&boundaries](size_t slab)
+        { return slab == 0 ? std::numeric_limits<double>::infinity() : boundaries[slab - 1]; };
+        auto getSlabBottom = [&boundaries](size_t slab)
+        { return slab == boundaries.size() ? -std::numeric_limits<double>::infinity() : boundaries[slab]; };
+
+        // Every line goes to each slab its y-range overlaps, including slabs it only touches.
+        std::vector<std::vector<size_t>> slabLines(numSlabs);
+        for (size_t i = 0; i < m_lines.size(); ++i)
+        {
+            double maxY = std::max(m_lines[i].getStartPoint().y(), m_lines[i].getEndPoint().y());
+            double minY = std::min(m_lines[i].getStartPoint().y(), m_lines[i].getEndPoint().y());
+            size_t firstSlab = std::lower_bound(boundaries.begin(), boundaries.end(), maxY, std::greater<double>()) - boundaries.begin();
+            size_t lastSlab = std::upper_bound(boundaries.begin(), boundaries.end(), minY, std::greater<double>()) - boundaries.begin();
+            for (size_t slab = firstSlab; slab <= lastSlab; ++slab)
+            {
+                slabLines[slab].push_back(i);
+            }
+        }
+
+        // Intersections on slab boundaries (and with unclipped lines, near them) may be found in more than one slab,
+        // so only the intersecting pairs are collected here and deduplicated below.
+        std::vector<std::vector<std::pair<size_t, size_t>>> slabPairs(numSlabs);
+        utility::parallelForChunks(numSlabs, numSlabs, [&](size_t, size_t, size_t slab)
+        {
+            const auto &lineIndices = slabLines[slab];
+            std::vector<primitives::LineSegment> clippedLines;
+            clippedLines.reserve(lineIndices.size());
+            for (size_t idx : lineIndices)
+            {
+                clippedLines.push_back(clipToSlab(m_lines[idx], getSlabBottom(slab), getSlabTop(slab)));
+            }
+
+            Planesweep slabSweep(clippedLines);
+            slabSweep.perform([&](const SegmentIntersection &intersection)
+            {
+                size_t first = lineIndices[intersection.firstSegment];
+                size_t second = lineIndices[intersection.secondSegment];
+                slabPairs[slab].push_back({std::min(first, second), std::max(first, second)});
+            });
+        });
+
+        std::vector<std::pair<size_t, size_t>> pairs;
+        for (const auto &slabPairsOfSlab : slabPairs)
+        {
+            pairs.insert(pairs.end(), slabPairsOfSlab.begin(), slabPairsOfSlab.end());
+        }
+        std::sort(pairs.begin(), pairs.end());
+        pairs.erase(std::unique(pairs.begin(), pairs.end()), pairs.end());
+
+        // Intersections are recomputed from the unclipped lines.
+        std::vector<primitives::LineLineIntersection> intersections(pairs.size());
+        utility::parallelForChunks(pairs.size(), numSlabs, [&](size_t begin, size_t end, size_t)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                intersections[i] = m_lines[pairs[i].first].computeIntersection(m_lines[pairs[i].second]);
+            }
+        });
+
+        intersectionsOut.reserve(intersectionsOut.size() + pairs.size());
+        for (size_t i = 0; i < pairs.size(); ++i)
+        {
+            if (std::holds_alternative<std::monostate>(intersections[i]))
+            {
+                // Clipped lines touching within tolerance, while the original lines do not.
+                continue;
+            }
+            intersectionsOut.push_back({pairs[i].first, pairs[i].second, std::move(intersections[i])});
+        }
+    }
+
+    std::optional<SegmentIntersection> Planesweep::findAnyIntersection(SharedEndPoints sharedEndPoints)
+    {
+        IntersectionCallback ignoreIntersection = [](const SegmentIntersection &) {};
+        SweepState state(m_lines, ignoreIntersection);
+        state.detectionMode = sharedEndPoints;
+        runSweep(state, false);
+
+        return state.firstIntersection;
+    }
+
+    RedBluePlanesweep::RedBluePlanesweep(const std::vector<primitives::LineSegment> &redLines, const std::vector<primitives::LineSegment> &blueLines)
+        : m_redLines(redLines), m_blueLines(blueLines)
+    {
+    }
+
+    void RedBluePlanesweep::perform(const IntersectionCallback &onIntersection, bool layersAreCrossingFree)
+    {
+        std::vector<primitives::LineSegment> lines;
+        lines.reserve(m_redLines.size() + m_blueLines.size());
+        lines.insert(lines.end(), m_redLines.begin(), m_redLines.end());
+        lines.insert(lines.end(), m_blueLines.begin(), m_blueLines.end());
+
+        SweepState state(lines, onIntersection);
+        state.numRedLines = m_redLines.size();
+        state.skipSameColourPairs = layersAreCrossingFree;
+        runSweep(state, false);
+    }
+
+    void RedBluePlanesweep::perform(std::vector<SegmentIntersection> &intersectionsOut, bool layersAreCrossingFree)
+    {
+        perform([&intersectionsOut](const SegmentIntersection &intersection)
+                { intersectionsOut.push_back(intersection); },
+                layersAreCrossingFree);
+    }
+
+    StreamingPlanesweep::StreamingPlanesweep(const std::filesystem::path &lineSegmentFilePath) : m_lineSegmentFilePath(lineSegmentFilePath)
+    {
+    }
+
+    void StreamingPlanesweep::perform(const IntersectionCallback &onIntersection)
+    {
+        utility::LineSegmentFileReader reader(m_lineSegmentFilePath);
+
+        std::vector<primitives::LineSegment> activeLines;
+        std::vector<size_t> fileLineIndices;
+        std::vector<size_t> freeSlots;
+        // Slots of lines whose lower end point has been processed at releasePosition. They are only reused
+        // once the sweep has moved on from there, so that a new line in the same slot cannot be mistaken for
+        // the old one by the deduplication of the intersections processed at that position.
+        std::vector<size_t> releasedSlots;
+        primitives::Point releasePosition;
+
+        SweepState state(activeLines, onIntersection);
+        state.fileLineIndices = &fileLineIndices;
+
+        size_t numActiveLines = 0;
+        m_peakNumActiveLines = 0;
+        size_t nextFileIdx = 0;
+        auto nextLine = reader.readNext();
+        std::optional<primitives::Point> previousUpperEndPoint;
+
+        while (true)
+        {
+            // Read all lines whose upper end point comes no later than the next queued event.
+            while (nextLine)
+            {
+                Event upperEndPointEvent(*nextLine, 0, true);
+                if (!state.eventQueue.empty() && state.eventQueue.top() < upperEndPointEvent)
+                {
+                    break;
+                }
+                const auto &upperEndPoint = upperEndPointEvent.getPosition();
+                if (previousUpperEndPoint && (upperEndPoint.y() > previousUpperEndPoint->y()
+                                              || (upperEndPoint.y() == previousUpperEndPoint->y() && upperEndPoint.x() < previousUpperEndPoint->x())))
+                {
+                    throw std::runtime_error("Line segment file is not sorted by upper end points.");
+                }
+                previousUpperEndPoint = upperEndPoint;
+
+                size_t slot = activeLines.size();
+                if (freeSlots.empty())
+                {
+                    activeLines.push_back(*nextLine);
+                    fileLineIndices.push_back(nextFileIdx);
+                }
+                else
+                {
+                    slot = freeSlots.back();
+                    freeSlots.pop_back();
+                    activeLines[slot] = *nextLine;
+                    fileLineIndices[slot] = nextFileIdx;
+                }
+                state.eventQueue.push(Event(activeLines[slot], slot, true));
+                state.eventQueue.push(Event(activeLines[slot], slot, false));
+                m_peakNumActiveLines = std::max(m_peakNumActiveLines, ++numActiveLines);
+
+                nextLine = reader.readNext();
+                ++nextFileIdx;
+            }
+
+            if (state.eventQueue.empty())
+            {
+                break;
+            }
+
+            const auto &nextEvent = state.eventQueue.top();
+            if (!releasedSlots.empty() && nextEvent.getPosition().squareDistance(releasePosition) >= 1e-6)
+            {
+                freeSlots.insert(freeSlots.end(), releasedSlots.begin(), releasedSlots.end());
+                releasedSlots.clear();
+            }
+
+            bool isLowerEndPoint = nextEvent.getType() == EventType::EndPoint && !nextEvent.isUpperEndPoint();
+            size_t slot = nextEvent.getFirstLineIdx();
+            auto position = nextEvent.getPosition();
+            processAndPopNextEvent(state);
+
+            if (isLowerEndPoint)
+            {
+                releasedSlots.push_back(slot);
+                releasePosition = position;
+                --numActiveLines;
+            }
+        }
+    }
+
 } // namespace algorithms
@@ -1,6 +1,9 @@
 #ifndef PLANESWEEP_HPP_INCLUDED
 #define PLANESWEEP_HPP_INCLUDED
 
+#include <filesystem>
+#include <functional>
+#include <optional>
 #include <vector>
 
 #include "primitives/linesegment.hpp"
@@ -10,6 +13,31 @@ namespace algorithms
 
 using LinePair = std::pair<primitives::LineSegment, primitives::LineSegment>;
 
+// Intersection between the line segments at indices firstSegment and secondSegment
+// of Planesweep::m_lines. intersection holds the intersection point, or the
+// overlapping segment if the two segments are collinear and overlapping.
+struct SegmentIntersection
+{
+    size_t firstSegment;
+    size_t secondSegment;
+    primitives::LineLineIntersection intersection;
+};
+
+using IntersectionCallback = std::function<void(const SegmentIntersection&)>;
+
+// Which intersections in a shared end point of two line segments are permitted by
+// Planesweep::findAnyIntersection. Overlapping line segments are never permitted.
+enum class SharedEndPoints
+{
+    // Any two line segments may share an end point.
+    Allowed,
+    // Only the line segments at indices i and (i + 1) % m_lines.size() may share an end point,
+    // as is the case for the edges of a closed polyline.
+    AllowedBetweenConsecutive,
+    // Every intersection is reported, including shared end points.
+    Forbidden
+};
+
 // Simple wrapper class around implementation of planesweep algorithm.
 // LineSegments can be added/removed from the m_lines vector and running
 // perform will run a planesweep on the LineSegments currently in m_lines.
@@ -17,11 +45,68 @@ struct Planesweep
 {
     Planesweep(const std::vector<primitives::LineSegment>& lines);
 
+    // Reports every intersection to onIntersection as soon as it is found.
+    void perform(const IntersectionCallback& onIntersection, bool printDebugInfo = false);
+    // Appends every intersection to intersectionsOut, which is not cleared first.
+    void perform(std::vector<SegmentIntersection>& intersectionsOut, bool printDebugInfo = false);
+    // Returns copies of every pair of intersecting line segments.
     std::vector<LinePair> perform(bool printDebugInfo = false);
 
+    // Parallel mode: Splits the plane into one horizontal slab per thread, each holding (almost)
+    // the same number of end points, and sweeps every slab on its own thread with the line segments
+    // clipped to it. Appends every intersection to intersectionsOut, once per pair of line segments,
+    // with firstSegment < secondSegment and ordered by (firstSegment, secondSegment).
+    // numThreads = 0 means as many threads as the hardware has.
+    void performParallel(std::vector<SegmentIntersection>& intersectionsOut, size_t numThreads = 0);
+
+    // Shamos-Hoey style detection: Sweeps only the end point events and stops at the first
+    // intersection not permitted by sharedEndPoints, which is returned. Returns std::nullopt
+    // if there is none. Runs in O(n log n) regardless of the number of intersections.
+    std::optional<SegmentIntersection> findAnyIntersection(SharedEndPoints sharedEndPoints = SharedEndPoints::Forbidden);
+
     std::vector<primitives::LineSegment> m_lines;
 };
 
+// Red-blue variant of Planesweep: Only intersections between a red and a blue line segment
+// are reported, with firstSegment indexing m_redLines and secondSegment indexing m_blueLines.
+// If the caller guarantees that the line segments of each colour do not cross each other
+// (sharing end points is fine), layersAreCrossingFree can be set, in which case same-colour
+// pairs are never tested and the running time only depends on the number of red-blue
+// intersections. Otherwise the same-colour intersections are still processed to keep the
+// status line in order, but are not reported.
+struct RedBluePlanesweep
+{
+    RedBluePlanesweep(const std::vector<primitives::LineSegment>& redLines, const std::vector<primitives::LineSegment>& blueLines);
+
+    void perform(const IntersectionCallback& onIntersection, bool layersAreCrossingFree = false);
+    void perform(std::vector<SegmentIntersection>& intersectionsOut, bool layersAreCrossingFree = false);
+
+    std::vector<primitives::LineSegment> m_redLines;
+    std::vector<primitives::LineSegment> m_blueLines;
+};
+
+// Streaming variant of Planesweep over a binary line segment file as written by
+// utility::writeLineSegmentsToBinaryFile, i. e., sorted by upper end point. Line segments
+// are read only once the sweep line reaches them and dropped again once it passes their
+// lower end point, so memory stays proportional to the status line plus the pending events.
+// Intersections are reported to the callback as soon as they are found, with firstSegment
+// and secondSegment being the indices of the records in the file.
+struct StreamingPlanesweep
+{
+    StreamingPlanesweep(const std::filesystem::path& lineSegmentFilePath);
+
+    // Throws if the file is not sorted by upper end point.
+    void perform(const IntersectionCallback& onIntersection);
+
+    // The maximum number of line segments held in memory at once during the last perform.
+    size_t getPeakNumActiveLines() const { return m_peakNumActiveLines; }
+
+    std::filesystem::path m_lineSegmentFilePath;
+
+private:
+    size_t m_peakNumActiveLines = 0;
+};
+
 } // namespace algorithms
 
 #endif 
\ No newline at end of file
@@ -0,0 +1,397 @@
+#include "algorithms/planesweep/polygontriangulation.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <set>
+#include <stdexcept>
+
+namespace algorithms
+{
+
+namespace
+{
+
+constexpr const char *NotStrictlySimpleMessage = "Outer boundary and holes must be strictly simple, with the holes "
+                                                 "strictly inside the outer boundary and not touching each other.";
+
+enum class VertexType
+{
+    Start,
+    End,
+    Split,
+    Merge,
+    Regular
+};
+
+double getCross(const primitives::Point &origin, const primitives::Point &first, const primitives::Point &second)
+{
+    return (first.x() - origin.x()) * (second.y() - origin.y()) - (first.y() - origin.y()) * (second.x() - origin.x());
+}
+
+// Boundaries of the polygon as a single vertex list with ring links, oriented such that the interior is on the
+// left of every edge. Edge i goes from vertex i to vertex next[i].
+struct PolygonRings
+{
+    void addRing(const primitives::Polygon &ring, bool isOuter)
+    {
+        size_t offset = points.size();
+        size_t size = ring.size();
+        bool isReversed = (ring.getSignedArea() > 0.) != isOuter;
+        for (size_t i = 0; i < size; ++i)
+        {
+            points.push_back(ring.getVertex(i));
+            size_t following = offset + (i + 1) % size;
+            size_t preceding = offset + (i + size - 1) % size;
+            next.push_back(isReversed ? preceding : following);
+            prev.push_back(isReversed ? following : preceding);
+        }
+    }
+
+    // Sweep order: from top to bottom, and from left to right among points of the same height, as if the
+    // plane was rotated slightly clockwise.
+    bool isAbove(size_t first, size_t second) const
+    {
+        if (points[first].y() != points[second].y()) return points[first].y() > points[second].y();
+        if (points[first].x() != points[second].x()) return points[first].x() < points[second].x();
+        return first < second;
+    }
+
+    std::vector<primitives::Point> points;
+    std::vector<size_t> next;
+    std::vector<size_t> prev;
+};
+
+struct XCoordinate
+{
+    double x;
+};
+
+// Orders the edges crossing the sweep line from left to right.
+struct EdgeComparator
+{
+    using is_transparent = void;
+
+    double getXAt(size_t edge) const
+    {
+        const auto &start = rings->points[edge];
+        const auto &end = rings->points[rings->next[edge]];
+        if (start.y() == end.y())
+        {
+            // In the rotated plane the sweep line meets horizontal edges at the x-coordinate of the sweep point.
+            return std::clamp(sweepPoint->x(), std::min(start.x(), end.x()), std::max(start.x(), end.x()));
+        }
+        return start.x() + (sweepPoint->y() - start.y()) * (end.x() - start.x()) / (end.y() - start.y());
+    }
+
+    bool operator()(size_t lhs, size_t rhs) const
+    {
+        double lhsX = getXAt(lhs);
+        double rhsX = getXAt(rhs);
+        if (lhsX != rhsX) return lhsX < rhsX;
+        return lhs < rhs;
+    }
+    bool operator()(size_t lhs, XCoordinate rhs) const { return getXAt(lhs) < rhs.x; }
+    bool operator()(XCoordinate lhs, size_t rhs) const { return lhs.x < getXAt(rhs); }
+
+    const PolygonRings *rings;
+    const primitives::Point *sweepPoint;
+};
+
+VertexType getVertexType(const PolygonRings &rings, size_t vertex)
+{
+    size_t prev = rings.prev[vertex];
+    size_t next = rings.next[vertex];
+    bool isConvex = getCross(rings.points[prev], rings.points[vertex], rings.points[next]) > 0.;
+    bool isPrevBelow = rings.isAbove(vertex, prev);
+    bool isNextBelow = rings.isAbove(vertex, next);
+
+    if (isPrevBelow && isNextBelow) return isConvex ? VertexType::Start : VertexType::Split;
+    if (!isPrevBelow && !isNextBelow) return isConvex ? VertexType::End : VertexType::Merge;
+    return VertexType::Regular;
+}
+
+// Finds the diagonals splitting the polygon into y-monotone pieces, following de Berg et al., "Computational
+// Geometry", chapter 3.2. The sweep status holds the edges with the interior on their right, each with its
+// helper, i. e., the lowest vertex above the sweep line which sees the edge horizontally to its right.
+std::vector<std::pair<size_t, size_t>> computeMonotoneDiagonals(const PolygonRings &rings)
+{
+    size_t numVertices = rings.points.size();
+    std::vector<size_t> order(numVertices);
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&rings](size_t lhs, size_t rhs) { return rings.isAbove(lhs, rhs); });
+
+    // Rings touching themselves or each other in a vertex are accepted by the Polygon constructor, but break the
+    // sweep. The copies of such a vertex are next to each other in sweep order.
+    for (size_t i = 1; i < numVertices; ++i)
+    {
+        const auto &previous = rings.points[order[i - 1]];
+        const auto &current = rings.points[order[i]];
+        if (previous.x() == current.x() && previous.y() == current.y())
+        {
+            throw std::invalid_argument(NotStrictlySimpleMessage);
+        }
+    }
+
+    std::vector<VertexType> types(numVertices);
+    for (size_t v = 0; v < numVertices; ++v)
+    {
+        types[v] = getVertexType(rings, v);
+    }
+
+    primitives::Point sweepPoint;
+    using Status = std::set<size_t, EdgeComparator>;
+    Status status(EdgeComparator{&rings, &sweepPoint});
+    std::vector<Status::iterator> statusEntries(numVertices, status.end());
+    std::vector<size_t> helpers(numVertices);
+    std::vector<std::pair<size_t, size_t>> diagonals;
+
+    auto insertEdge = [&](size_t edge, size_t helper)
+    {
+        statusEntries[edge] = status.insert(edge).first;
+        helpers[edge] = helper;
+    };
+    auto removeEdge = [&](size_t edge, size_t vertex)
+    {
+        if (types[helpers[edge]] == VertexType::Merge)
+        {
+            diagonals.emplace_back(vertex, helpers[edge]);
+        }
+        status.erase(statusEntries[edge]);
+    };
+    auto updateLeftEdge = [&](size_t vertex)
+    {
+        auto leftEdge = status.lower_bound(XCoordinate{sweepPoint.x()});
+        if (leftEdge == status.begin())
+        {
+            throw std::invalid_argument(NotStrictlySimpleMessage);
+        }
+        --leftEdge;
+        if (types[helpers[*leftEdge]] == VertexType::Merge || types[vertex] == VertexType::Split)
+        {
+            diagonals.emplace_back(vertex, helpers[*leftEdge]);
+        }
+        helpers[*leftEdge] = vertex;
+    };
+
+    for (size_t vertex : order)
+    {
+        sweepPoint = rings.points[vertex];
+        size_t prevEdge = rings.prev[vertex];
+        switch (types[vertex])
+        {
+        case VertexType::Start:
+            insertEdge(vertex, vertex);
+            break;
+        case VertexType::End:
+            removeEdge(prevEdge, vertex);
+            break;
+        case VertexType::Split:
+            updateLeftEdge(vertex);
+            insertEdge(vertex, vertex);
+            break;
+        case VertexType::Merge:
+            removeEdge(prevEdge, vertex);
+            updateLeftEdge(vertex);
+            break;
+        case VertexType::Regular:
+            // The interior is on the right if the boundary goes downwards here.
+            if (rings.isAbove(prevEdge, vertex))
+            {
+                removeEdge(prevEdge, vertex);
+                insertEdge(vertex, vertex);
+            }
+            else
+            {
+                updateLeftEdge(vertex);
+            }
+            break;
+        }
+    }
+
+    return diagonals;
+}
+
+// Splits the polygon along the diagonals and returns the boundary of every piece in counterclockwise order.
+std::vector<std::vector<size_t>> getMonotonePieces(const PolygonRings &rings, const std::vector<std::pair<size_t, size_t>> &diagonals)
+{
+    size_t numVertices = rings.points.size();
+
+    // The ring edges and the diagonals, smaller vertex first and without duplicates.
+    std::vector<std::pair<size_t, size_t>> edges;
+    edges.reserve(numVertices + diagonals.size());
+    for (size_t v = 0; v < numVertices; ++v)
+    {
+        edges.emplace_back(std::min(v, rings.next[v]), std::max(v, rings.next[v]));
+    }
+    for (const auto &[first, second] : diagonals)
+    {
+        edges.emplace_back(std::min(first, second), std::max(first, second));
+    }
+    std::sort(edges.begin(), edges.end());
+    edges.erase(std::unique(edges.begin(), edges.end()), edges.end());
+
+    // Half-edges 2 e and 2 e + 1 run along edge e in both directions, so the twin of half-edge h is h ^ 1. The
+    // half-edges leaving vertex v are outgoing[outgoingOffsets[v]] to outgoing[outgoingOffsets[v + 1] - 1],
+    // sorted by angle, and positions holds the index of every half-edge within the ones leaving its origin.
+    size_t numHalfEdges = 2 * edges.size();
+    std::vector<size_t> origins(numHalfEdges);
+    for (size_t e = 0; e < edges.size(); ++e)
+    {
+        origins[2 * e] = edges[e].first;
+        origins[2 * e + 1] = edges[e].second;
+    }
+    auto getTarget = [&origins](size_t halfEdge) { return origins[halfEdge ^ 1]; };
+
+    std::vector<size_t> outgoingOffsets(numVertices + 1, 0);
+    for (size_t h = 0; h < numHalfEdges; ++h)
+    {
+        ++outgoingOffsets[origins[h] + 1];
+    }
+    std::partial_sum(outgoingOffsets.begin(), outgoingOffsets.end(), outgoingOffsets.begin());
+    std::vector<size_t> outgoing(numHalfEdges);
+    std::vector<double> angles(numHalfEdges);
+    {
+        std::vector<size_t> fillPositions(outgoingOffsets.begin(), outgoingOffsets.end() - 1);
+        for (size_t h = 0; h < numHalfEdges; ++h)
+        {
+            outgoing[fillPositions[origins[h]]++] = h;
+            const auto &origin = rings.points[origins[h]];
+            const auto &target = rings.points[getTarget(h)];
+            angles[h] = std::atan2(target.y() - origin.y(), target.x() - origin.x());
+        }
+    }
+    std::vector<size_t> positions(numHalfEdges);
+    for (size_t v = 0; v < numVertices; ++v)
+    {
+        std::sort(outgoing.begin() + outgoingOffsets[v], outgoing.begin() + outgoingOffsets[v + 1],
+                  [&angles](size_t lhs, size_t rhs) { return angles[lhs] < angles[rhs]; });
+        for (size_t i = outgoingOffsets[v]; i < outgoingOffsets[v + 1]; ++i)
+        {
+            positions[outgoing[i]] = i - outgoingOffsets[v];
+        }
+    }
+
+    // Only the half-edges with the interior on their left are walked, so only those are marked as unvisited.
+    std::vector<bool> isVisited(numHalfEdges);
+    for (size_t h = 0; h < numHalfEdges; ++h)
+    {
+        isVisited[h] = getTarget(h) == rings.prev[origins[h]];
+    }
+
+    std::vector<std::vector<size_t>> pieces;
+    for (size_t i = 0; i < numHalfEdges; ++i)
+    {
+        if (isVisited[outgoing[i]]) continue;
+
+        // Turning clockwise at every vertex keeps the piece on the left.
+        std::vector<size_t> piece;
+        size_t halfEdge = outgoing[i];
+        while (!isVisited[halfEdge])
+        {
+            isVisited[halfEdge] = true;
+            piece.push_back(origins[halfEdge]);
+            size_t to = getTarget(halfEdge);
+            size_t degree = outgoingOffsets[to + 1] - outgoingOffsets[to];
+            halfEdge = outgoing[outgoingOffsets[to] + (positions[halfEdge ^ 1] + degree - 1) % degree];
+        }
+        pieces.push_back(std::move(piece));
+    }
+
+    return pieces;
+}
+
+// Triangulates a y-monotone piece with the stack based algorithm of de Berg et al., chapter 3.3.
+void triangulateMonotonePiece(const PolygonRings &rings, const std::vector<size_t> &piece, std::vector<size_t> &indicesOut)
+{
+    auto addTriangle = [&](size_t first, size_t second, size_t third)
+    {
+        if (getCross(rings.points[first], rings.points[second], rings.points[third]) < 0.)
+        {
+            std::swap(second, third);
+        }
+        indicesOut.insert(indicesOut.end(), {first, second, third});
+    };
+
+    if (piece.size() == 3)
+    {
+        addTriangle(piece[0], piece[1], piece[2]);
+        return;
+    }
+
+    std::vector<size_t> order(piece.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&](size_t lhs, size_t rhs) { return rings.isAbove(piece[lhs], piece[rhs]); });
+
+    // Going counterclockwise from the top vertex leads down the left chain.
+    std::vector<bool> isOnLeftChain(piece.size(), false);
+    for (size_t i = order.front(); i != order.back(); i = (i + 1) % piece.size())
+    {
+        isOnLeftChain[i] = true;
+    }
+
+    std::vector<size_t> stack = {order[0], order[1]};
+    for (size_t j = 2; j + 1 < order.size(); ++j)
+    {
+        size_t current = order[j];
+        if (isOnLeftChain[current] != isOnLeftChain[stack.back()])
+        {
+            for (size_t k = 0; k + 1 < stack.size(); ++k)
+            {
+                addTriangle(piece[current], piece[stack[k]], piece[stack[k + 1]]);
+            }
+            stack = {order[j - 1], current};
+        }
+        else
+        {
+            size_t last = stack.back();
+            stack.pop_back();
+            while (!stack.empty())
+            {
+                double cross = getCross(rings.points[piece[current]], rings.points[piece[stack.back()]], rings.points[piece[last]]);
+                if (isOnLeftChain[current] ? cross <= 0. : cross >= 0.) break;
+
+                addTriangle(piece[current], piece[last], piece[stack.back()]);
+                last = stack.back();
+                stack.pop_back();
+            }
+            stack.push_back(last);
+            stack.push_back(current);
+        }
+    }
+
+    for (size_t k = 0; k + 1 < stack.size(); ++k)
+    {
+        addTriangle(piece[order.back()], piece[stack[k]], piece[stack[k + 1]]);
+    }
+}
+
+} // namespace
+
+Triangulation triangulatePolygon(const primitives::PolygonWithHoles &polygon)
+{
+    PolygonRings rings;
+    rings.addRing(polygon.outer, true);
+    for (const auto &hole : polygon.holes)
+    {
+        rings.addRing(hole, false);
+    }
+
+    auto diagonals = computeMonotoneDiagonals(rings);
+
+    Triangulation triangulation;
+    for (const auto &piece : getMonotonePieces(rings, diagonals))
+    {
+        triangulateMonotonePiece(rings, piece, triangulation.indices);
+    }
+    triangulation.vertices = std::move(rings.points);
+
+    return triangulation;
+}
+
+Triangulation triangulatePolygon(const primitives::Polygon &polygon)
+{
+    return triangulatePolygon(primitives::PolygonWithHoles{polygon, {}});
+}
+
+} // namespace algorithms
@@ -0,0 +1,25 @@
+#ifndef POLYGONTRIANGULATION_HPP_INCLUDED
+#define POLYGONTRIANGULATION_HPP_INCLUDED
+
+#include "algorithms/delaunay/triangulation.hpp"
+#include "primitives/polygon.hpp"
+
+namespace algorithms
+{
+
+// Triangulates a polygon in O(n log n) by splitting it into y-monotone pieces with a sweep from top to
+// bottom, each of which is then triangulated in linear time.
+//
+// The vertices of the result are those of the outer boundary followed by those of each hole, in the order
+// they are given, which may be either orientation. A polygon with n vertices and h holes gets n + 2h - 2
+// triangles.
+//
+// The outer boundary and the holes must be strictly simple, i. e., unlike for Polygon they must not touch
+// themselves in a vertex, and the holes must lie strictly inside the outer boundary without touching each other.
+// Rings touching in a vertex make it throw std::invalid_argument.
+Triangulation triangulatePolygon(const primitives::PolygonWithHoles& polygon);
+Triangulation triangulatePolygon(const primitives::Polygon& polygon);
+
+} // namespace algorithms
+
+#endif
@@ -0,0 +1,263 @@
+#include "algorithms/planesweep/segmentgrid.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <cstdint>
+#include <stdexcept>
+#include <tuple>
+
+#include "utility/parallel.hpp"
+
+namespace algorithms
+{
+
+namespace
+{
+
+struct BoundingBox
+{
+    double minX;
+    double minY;
+    double maxX;
+    double maxY;
+};
+
+BoundingBox getBoundingBox(const primitives::LineSegment &line)
+{
+    const auto &start = line.getStartPoint();
+    const auto &end = line.getEndPoint();
+    return {std::min(start.x(), end.x()), std::min(start.y(), end.y()),
+            std::max(start.x(), end.x()), std::max(start.y(), end.y())};
+}
+
+size_t getCellCoordinate(double coordinate, double gridMin, double cellSize, size_t numCells)
+{
+    return std::min(numCells - 1, static_cast<size_t>(std::max(0., (coordinate - gridMin) / cellSize)));
+}
+
+} // namespace
+
+SegmentStatistics computeSegmentStatistics(const std::vector<primitives::LineSegment> &lines)
+{
+    SegmentStatistics statistics;
+    statistics.numLines = lines.size();
+    if (lines.empty())
+    {
+        return statistics;
+    }
+
+    auto firstBox = getBoundingBox(lines.front());
+    statistics.minX = firstBox.minX;
+    statistics.minY = firstBox.minY;
+    statistics.maxX = firstBox.maxX;
+    statistics.maxY = firstBox.maxY;
+    double extentSum = 0.;
+    // Sum of the doubled direction angles as unit vectors, weighted by length, so that opposite directions agree.
+    double doubledDirectionX = 0.;
+    double doubledDirectionY = 0.;
+    double lengthSum = 0.;
+    for (const auto &line : lines)
+    {
+        double dx = line.getEndPoint().x() - line.getStartPoint().x();
+        double dy = line.getEndPoint().y() - line.getStartPoint().y();
+        double squareLength = dx * dx + dy * dy;
+        double length = std::sqrt(squareLength);
+        doubledDirectionX += (dx * dx - dy * dy) / length;
+        doubledDirectionY += 2. * dx * dy / length;
+        lengthSum += length;
+
+        auto box = getBoundingBox(line);
+        statistics.minX = std::min(statistics.minX, box.minX);
+        statistics.minY = std::min(statistics.minY, box.minY);
+        statistics.maxX = std::max(statistics.maxX, box.maxX);
+        statistics.maxY = std::max(statistics.maxY, box.maxY);
+        extentSum += std::max(box.maxX - box.minX, box.maxY - box.minY);
+    }
+    statistics.meanExtent = extentSum / lines.size();
+    statistics.orientationSpread = 1. - std::sqrt(doubledDirectionX * doubledDirectionX + doubledDirectionY * doubledDirectionY) / lengthSum;
+
+    double width = statistics.maxX - statistics.minX;
+    double height = statistics.maxY - statistics.minY;
+    double minCellSize = std::max(std::sqrt(width * height / lines.size()), std::max(width, height) / lines.size());
+    statistics.cellSize = std::max(statistics.meanExtent, minCellSize);
+    statistics.numCellsX = static_cast<size_t>(width / statistics.cellSize) + 1;
+    statistics.numCellsY = static_cast<size_t>(height / statistics.cellSize) + 1;
+
+    for (const auto &line : lines)
+    {
+        auto box = getBoundingBox(line);
+        double cellsX = std::floor((box.maxX - statistics.minX) / statistics.cellSize) - std::floor((box.minX - statistics.minX) / statistics.cellSize) + 1;
+        double cellsY = std::floor((box.maxY - statistics.minY) / statistics.cellSize) - std::floor((box.minY - statistics.minY) / statistics.cellSize) + 1;
+        statistics.numCellReferences += cellsX * cellsY;
+    }
+
+    // Two segments of length L, placed and oriented uniformly at random in an area A, intersect with
+    // probability of about 2 L^2 / (pi A).
+    constexpr double pi = 3.14159265358979323846;
+    double numLines = static_cast<double>(lines.size());
+    double area = std::max(width * height, statistics.cellSize * statistics.cellSize);
+    double numPairs = numLines * (numLines - 1.) / 2.;
+    statistics.estimatedNumIntersections = std::min(numPairs, statistics.orientationSpread * numPairs * 2. * statistics.meanExtent * statistics.meanExtent / (pi * area));
+
+    return statistics;
+}
+
+SegmentGrid::SegmentGrid(const std::vector<primitives::LineSegment> &lines) : m_lines(lines)
+{
+}
+
+void SegmentGrid::perform(std::vector<SegmentIntersection> &intersectionsOut, size_t numThreads)
+{
+    auto statistics = computeSegmentStatistics(m_lines);
+    const double cellSize = statistics.cellSize;
+    auto getCellX = [&statistics, cellSize](double x)
+    { return getCellCoordinate(x, statistics.minX, cellSize, statistics.numCellsX); };
+    auto getCellY = [&statistics, cellSize](double y)
+    { return getCellCoordinate(y, statistics.minY, cellSize, statistics.numCellsY); };
+    auto getCellKey = [&statistics](size_t cellX, size_t cellY)
+    { return static_cast<uint64_t>(cellY) * statistics.numCellsX + cellX; };
+
+    std::vector<BoundingBox> boxes;
+    boxes.reserve(m_lines.size());
+    for (const auto &line : m_lines)
+    {
+        boxes.push_back(getBoundingBox(line));
+    }
+
+    // (cell key, line index) for every cell overlapped by a line's bounding box. Sorting these groups the
+    // lines by cell, so only the non-empty cells are ever stored.
+    std::vector<std::pair<uint64_t, size_t>> cellReferences;
+    cellReferences.reserve(static_cast<size_t>(statistics.numCellReferences));
+    for (size_t i = 0; i < m_lines.size(); ++i)
+    {
+        for (size_t cellY = getCellY(boxes[i].minY); cellY <= getCellY(boxes[i].maxY); ++cellY)
+        {
+            for (size_t cellX = getCellX(boxes[i].minX); cellX <= getCellX(boxes[i].maxX); ++cellX)
+            {
+                cellReferences.push_back({getCellKey(cellX, cellY), i});
+            }
+        }
+    }
+    std::sort(cellReferences.begin(), cellReferences.end());
+
+    std::vector<size_t> cellOffsets;
+    for (size_t r = 0; r < cellReferences.size(); ++r)
+    {
+        if (r == 0 || cellReferences[r].first != cellReferences[r - 1].first)
+        {
+            cellOffsets.push_back(r);
+        }
+    }
+    size_t numCells = cellOffsets.size();
+    cellOffsets.push_back(cellReferences.size());
+
+    size_t numChunks = std::min(utility::getNumThreads(numThreads), std::max<size_t>(1, numCells));
+    std::vector<std::vector<SegmentIntersection>> chunkIntersections(numChunks);
+    utility::parallelForChunks(numCells, numChunks, [&](size_t cellBegin, size_t cellEnd, size_t chunkIdx)
+    {
+        auto &intersections = chunkIntersections[chunkIdx];
+        for (size_t cell = cellBegin; cell < cellEnd; ++cell)
+        {
+            uint64_t cellKey = cellReferences[cellOffsets[cell]].first;
+            for (size_t r1 = cellOffsets[cell]; r1 < cellOffsets[cell + 1]; ++r1)
+            {
+                size_t first = cellReferences[r1].second;
+                for (size_t r2 = r1 + 1; r2 < cellOffsets[cell + 1]; ++r2)
+                {
+                    size_t second = cellReferences[r2].second;
+                    const auto &firstBox = boxes[first];
+                    const auto &secondBox = boxes[second];
+                    if (firstBox.maxX < secondBox.minX || secondBox.maxX < firstBox.minX || firstBox.maxY < secondBox.minY || secondBox.maxY < firstBox.minY)
+                    {
+                        continue;
+                    }
+
+                    // Pairs sharing more than one cell are only tested in the reference cell.
+                    double referenceX = std::max(firstBox.minX, secondBox.minX);
+                    double referenceY = std::max(firstBox.minY, secondBox.minY);
+                    if (getCellKey(getCellX(referenceX), getCellY(referenceY)) != cellKey)
+                    {
+                        continue;
+                    }
+
+                    auto intersection = m_lines[first].computeIntersection(m_lines[second]);
+                    if (std::holds_alternative<std::monostate>(intersection))
+                    {
+                        continue;
+                    }
+                    intersections.push_back({first, second, std::move(intersection)});
+                }
+            }
+        }
+    });
+
+    size_t firstNew = intersectionsOut.size();
+    for (auto &intersections : chunkIntersections)
+    {
+        intersectionsOut.insert(intersectionsOut.end(), std::make_move_iterator(intersections.begin()), std::make_move_iterator(intersections.end()));
+    }
+    std::sort(intersectionsOut.begin() + firstNew, intersectionsOut.end(), [](const SegmentIntersection &lhs, const SegmentIntersection &rhs)
+    {
+        return std::tie(lhs.firstSegment, lhs.secondSegment) < std::tie(rhs.firstSegment, rhs.secondSegment);
+    });
+}
+
+void SegmentGrid::perform(const IntersectionCallback &onIntersection, size_t numThreads)
+{
+    std::vector<SegmentIntersection> intersections;
+    perform(intersections, numThreads);
+    for (const auto &intersection : intersections)
+    {
+        onIntersection(intersection);
+    }
+}
+
+IntersectionStrategy selectIntersectionStrategy(const SegmentStatistics &statistics)
+{
+    double numLines = static_cast<double>(statistics.numLines);
+    if (numLines < 2)
+    {
+        return IntersectionStrategy::Planesweep;
+    }
+
+    // Relative costs of the basic operations, roughly measured: Sorting a cell reference, testing
+    // a pair of line segments, and processing an end point or intersection event of the sweep
+    // (heap and status line updates plus the neighbour tests).
+    constexpr double referenceSortCost = 1.;
+    constexpr double pairTestCost = 2.;
+    constexpr double sweepEventCost = 12.;
+
+    // Assuming the line segments are spread evenly over the grid cells.
+    double numCells = static_cast<double>(statistics.numCellsX) * statistics.numCellsY;
+    double referencesPerCell = std::max(1., statistics.numCellReferences / numCells);
+    double gridCost = statistics.numCellReferences * (referenceSortCost * std::log2(statistics.numCellReferences + 1.) + pairTestCost * referencesPerCell / 2.);
+    double sweepCost = (2. * numLines + statistics.estimatedNumIntersections) * sweepEventCost * std::log2(numLines);
+
+    return gridCost < sweepCost ? IntersectionStrategy::UniformGrid : IntersectionStrategy::Planesweep;
+}
+
+void computeIntersections(const std::vector<primitives::LineSegment> &lines,
+                          std::vector<SegmentIntersection> &intersectionsOut,
+                          size_t numThreads)
+{
+    if (selectIntersectionStrategy(computeSegmentStatistics(lines)) == IntersectionStrategy::UniformGrid)
+    {
+        SegmentGrid(lines).perform(intersectionsOut, numThreads);
+        return;
+    }
+
+    // The sweep gives up on overlapping collinear line segments, which the grid reports like any other
+    // intersection. So the result does not depend on the chosen strategy, the grid takes over in that case.
+    size_t numPreviousIntersections = intersectionsOut.size();
+    try
+    {
+        Planesweep(lines).performParallel(intersectionsOut, numThreads);
+    }
+    catch (const std::logic_error &)
+    {
+        intersectionsOut.erase(intersectionsOut.begin() + numPreviousIntersections, intersectionsOut.end());
+        SegmentGrid(lines).perform(intersectionsOut, numThreads);
+    }
+}
+
+} // namespace algorithms
@@ -0,0 +1,74 @@
+#ifndef SEGMENTGRID_HPP_INCLUDED
+#define SEGMENTGRID_HPP_INCLUDED
+
+#include <vector>
+
+#include "algorithms/planesweep/planesweep.hpp"
+#include "primitives/linesegment.hpp"
+
+namespace algorithms
+{
+
+// Cheap statistics of a set of line segments, computed in a single pass. The grid resolution
+// of SegmentGrid and the cost model of selectIntersectionStrategy are both derived from them.
+struct SegmentStatistics
+{
+    size_t numLines = 0;
+    double minX = 0.;
+    double minY = 0.;
+    double maxX = 0.;
+    double maxY = 0.;
+    // Mean of max(|dx|, |dy|) over all line segments.
+    double meanExtent = 0.;
+    // Side length of the grid cells, roughly the mean extent, but large enough that there are
+    // no more cells than line segments.
+    double cellSize = 1.;
+    size_t numCellsX = 1;
+    size_t numCellsY = 1;
+    // Total number of grid cells overlapped by the bounding boxes of the line segments.
+    double numCellReferences = 0.;
+    // 0 if all line segments are parallel, 1 if their directions are spread evenly.
+    double orientationSpread = 0.;
+    // Expected number of intersections of line segments with the mean extent and orientation
+    // spread placed uniformly in the bounding box.
+    double estimatedNumIntersections = 0.;
+};
+
+SegmentStatistics computeSegmentStatistics(const std::vector<primitives::LineSegment>& lines);
+
+// Broad phase for many short line segments: Every line segment is registered in the cells of a
+// sparse uniform grid overlapped by its bounding box, and pairs are only tested within each cell.
+// Each pair is tested in one cell only, namely the one holding the lower left corner of the
+// intersection of the two bounding boxes. Has the same output contract as Planesweep::performParallel,
+// i. e., every intersection once with firstSegment < secondSegment, ordered by (firstSegment, secondSegment).
+struct SegmentGrid
+{
+    SegmentGrid(const std::vector<primitives::LineSegment>& lines);
+
+    // Appends every intersection to intersectionsOut. numThreads = 0 means as many threads as the hardware has.
+    void perform(std::vector<SegmentIntersection>& intersectionsOut, size_t numThreads = 0);
+    void perform(const IntersectionCallback& onIntersection, size_t numThreads = 0);
+
+    std::vector<primitives::LineSegment> m_lines;
+};
+
+enum class IntersectionStrategy
+{
+    Planesweep,
+    UniformGrid
+};
+
+// Estimates the cost of a grid based and a sweep based search from the statistics and returns the cheaper one.
+// The grid wins for many short line segments spread over the bounding box, the sweep as soon as long
+// line segments make the bounding boxes overlap many cells.
+IntersectionStrategy selectIntersectionStrategy(const SegmentStatistics& statistics);
+
+// Finds every intersection using the strategy chosen by selectIntersectionStrategy, with the output
+// contract of SegmentGrid::perform. Falls back to the grid if the sweep fails on overlapping line segments.
+void computeIntersections(const std::vector<primitives::LineSegment>& lines,
+                          std::vector<SegmentIntersection>& intersectionsOut,
+                          size_t numThreads = 0);
+
+} // namespace algorithms
+
+#endif
@@ -0,0 +1,322 @@
+#include "algorithms/simplification/simplification.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <functional>
+#include <limits>
+#include <numeric>
+#include <queue>
+#include <stdexcept>
+
+#include "algorithms/planesweep/planesweep.hpp"
+#include "utility/geomutils.hpp"
+
+namespace algorithms
+{
+
+namespace
+{
+
+constexpr double infinity = std::numeric_limits<double>::infinity();
+
+double getTriangleArea(const primitives::Point& p1, const primitives::Point& p2, const primitives::Point& p3)
+{
+    return std::abs((p2.x() - p1.x()) * (p3.y() - p1.y()) - (p2.y() - p1.y()) * (p3.x() - p1.x())) / 2.;
+}
+
+std::vector<double> rankDouglasPeucker(const std::vector<primitives::Point>& vertices, bool isRing)
+{
+    size_t size = vertices.size();
+    std::vector<double> importances(size, infinity);
+    if (size < 3) return importances;
+
+    // Vertices strictly between first and last still have to be ranked, where last may be size for vertex 0
+    // of a ring. None of them is more important than the vertex splitting off the range.
+    struct Range
+    {
+        size_t first;
+        size_t last;
+        double maxImportance;
+    };
+    auto getFarthestVertex = [&vertices, size](size_t first, size_t last, double& squareDistanceOut)
+    {
+        size_t farthest = first + 1;
+        squareDistanceOut = -1.;
+        for (size_t v = first + 1; v < last; ++v)
+        {
+            double squareDistance = utility::getSquareDistanceToSegment(vertices[v], vertices[first], vertices[last % size]);
+            if (squareDistance > squareDistanceOut)
+            {
+                squareDistanceOut = squareDistance;
+                farthest = v;
+            }
+        }
+        return farthest;
+    };
+
+    // Iterative rather than recursive, as the recursion gets as deep as the polyline is long on spirals.
+    std::vector<Range> ranges;
+    if (isRing)
+    {
+        // Vertex 0 and the vertex farthest from it split the ring into two polylines.
+        double squareDistance;
+        size_t farthest = getFarthestVertex(0, size, squareDistance);
+        ranges.push_back({0, farthest, infinity});
+        ranges.push_back({farthest, size, infinity});
+    }
+    else
+    {
+        ranges.push_back({0, size - 1, infinity});
+    }
+
+    while (!ranges.empty())
+    {
+        auto range = ranges.back();
+        ranges.pop_back();
+        if (range.last <= range.first + 1) continue;
+
+        double squareDistance;
+        size_t farthest = getFarthestVertex(range.first, range.last, squareDistance);
+        double importance = std::min(std::sqrt(squareDistance), range.maxImportance);
+        importances[farthest] = importance;
+        ranges.push_back({range.first, farthest, importance});
+        ranges.push_back({farthest, range.last, importance});
+    }
+
+    if (isRing)
+    {
+        // The most important vertex apart from the two split vertices makes the third one of a ring.
+        size_t third = 0;
+        for (size_t v = 0; v < size; ++v)
+        {
+            if (importances[v] != infinity && (importances[third] == infinity || importances[v] > importances[third]))
+            {
+                third = v;
+            }
+        }
+        importances[third] = infinity;
+    }
+    return importances;
+}
+
+std::vector<double> rankVisvalingam(const std::vector<primitives::Point>& vertices, bool isRing)
+{
+    size_t size = vertices.size();
+    std::vector<double> importances(size, infinity);
+    if (size < 3) return importances;
+
+    std::vector<size_t> previous(size);
+    std::vector<size_t> next(size);
+    for (size_t v = 0; v < size; ++v)
+    {
+        previous[v] = (v + size - 1) % size;
+        next[v] = (v + 1) % size;
+    }
+    auto isRemovable = [isRing, size](size_t v) { return isRing || (v != 0 && v != size - 1); };
+
+    // Queue of the vertices by the area of the triangle with their current neighbours. Entries become stale
+    // when that area changes, which areas tells.
+    using QueueEntry = std::pair<double, size_t>;
+    std::priority_queue<QueueEntry, std::vector<QueueEntry>, std::greater<QueueEntry>> queue;
+    std::vector<double> areas(size, infinity);
+    auto updateArea = [&](size_t v)
+    {
+        if (!isRemovable(v)) return;
+
+        areas[v] = getTriangleArea(vertices[previous[v]], vertices[v], vertices[next[v]]);
+        queue.emplace(areas[v], v);
+    };
+    for (size_t v = 0; v < size; ++v)
+    {
+        updateArea(v);
+    }
+
+    size_t numRemaining = size;
+    size_t minNumRemaining = isRing ? 3 : 2;
+    double maxRemovedArea = 0.;
+    std::vector<char> isRemoved(size, false);
+    while (numRemaining > minNumRemaining && !queue.empty())
+    {
+        auto [area, v] = queue.top();
+        queue.pop();
+        if (isRemoved[v] || area != areas[v]) continue;
+
+        // Removing a vertex can shrink the triangles of its neighbours, which must not make them more
+        // important than it.
+        maxRemovedArea = std::max(maxRemovedArea, area);
+        importances[v] = maxRemovedArea;
+        isRemoved[v] = true;
+        --numRemaining;
+
+        next[previous[v]] = next[v];
+        previous[next[v]] = previous[v];
+        updateArea(previous[v]);
+        updateArea(next[v]);
+    }
+    return importances;
+}
+
+// Most important vertex strictly between first and last, cyclically, that isn't kept yet.
+size_t findMostImportantDroppedVertex(const std::vector<double>& importances, const std::vector<char>& isKept, size_t first, size_t last)
+{
+    size_t size = importances.size();
+    size_t mostImportant = size;
+    for (size_t v = (first + 1) % size; v != last; v = (v + 1) % size)
+    {
+        if (!isKept[v] && (mostImportant == size || importances[v] > importances[mostImportant]))
+        {
+            mostImportant = v;
+        }
+    }
+    return mostImportant;
+}
+
+// Marks the vertices kept for <tolerance> in isKept, on top of those already marked. With preserveTopology,
+// vertices are put back for as long as two edges of the result intersect: for both edges, the most important
+// of the vertices they replace. Returns the indices of the kept vertices.
+std::vector<size_t> selectVertices(const std::vector<primitives::Point>& vertices,
+                                   bool isRing,
+                                   const std::vector<double>& importances,
+                                   double tolerance,
+                                   bool preserveTopology,
+                                   std::vector<char>& isKept)
+{
+    for (size_t v = 0; v < vertices.size(); ++v)
+    {
+        if (importances[v] > tolerance)
+        {
+            isKept[v] = true;
+        }
+    }
+
+    while (true)
+    {
+        std::vector<size_t> kept;
+        for (size_t v = 0; v < vertices.size(); ++v)
+        {
+            if (isKept[v]) kept.push_back(v);
+        }
+        if (!preserveTopology || kept.size() < 3) return kept;
+
+        size_t numEdges = isRing ? kept.size() : kept.size() - 1;
+        std::vector<primitives::LineSegment> edges;
+        edges.reserve(numEdges);
+        for (size_t e = 0; e < numEdges; ++e)
+        {
+            edges.emplace_back(vertices[kept[e]], vertices[kept[(e + 1) % kept.size()]]);
+        }
+        Planesweep planesweep(edges);
+        auto intersection = planesweep.findAnyIntersection(SharedEndPoints::AllowedBetweenConsecutive);
+        if (!intersection) return kept;
+
+        bool isRepaired = false;
+        for (size_t e : {intersection->firstSegment, intersection->secondSegment})
+        {
+            size_t dropped = findMostImportantDroppedVertex(importances, isKept, kept[e], kept[(e + 1) % kept.size()]);
+            if (dropped != vertices.size())
+            {
+                isKept[dropped] = true;
+                isRepaired = true;
+            }
+        }
+        if (!isRepaired)
+        {
+            // Both edges are edges of the input.
+            throw std::invalid_argument("Polyline intersects itself");
+        }
+    }
+}
+
+std::vector<std::vector<primitives::Point>> simplify(const std::vector<primitives::Point>& vertices,
+                                                     bool isRing,
+                                                     const std::vector<double>& tolerances,
+                                                     SimplificationMethod method,
+                                                     bool preserveTopology)
+{
+    auto importances = rankVertices(vertices, isRing, method);
+
+    // From the largest tolerance to the smallest, so that vertices put back for one are kept for all smaller ones.
+    std::vector<size_t> order(tolerances.size());
+    std::iota(order.begin(), order.end(), 0);
+    std::sort(order.begin(), order.end(), [&tolerances](size_t lhs, size_t rhs) { return tolerances[lhs] > tolerances[rhs]; });
+
+    std::vector<std::vector<primitives::Point>> result(tolerances.size());
+    std::vector<char> isKept(vertices.size(), false);
+    for (size_t level : order)
+    {
+        for (size_t v : selectVertices(vertices, isRing, importances, tolerances[level], preserveTopology, isKept))
+        {
+            result[level].push_back(vertices[v]);
+        }
+    }
+    return result;
+}
+
+std::vector<primitives::Point> getVertices(const primitives::Polygon& polygon)
+{
+    std::vector<primitives::Point> vertices;
+    vertices.reserve(polygon.size());
+    for (size_t i = 0; i < polygon.size(); ++i)
+    {
+        vertices.push_back(polygon.getVertex(i));
+    }
+    return vertices;
+}
+
+} // namespace
+
+std::vector<double> rankVertices(const std::vector<primitives::Point>& vertices, bool isRing, SimplificationMethod method)
+{
+    if (isRing && vertices.size() < 3)
+    {
+        throw std::invalid_argument("A ring needs at least three vertices.");
+    }
+
+    switch (method)
+    {
+    case SimplificationMethod::DouglasPeucker:
+        return rankDouglasPeucker(vertices, isRing);
+    case SimplificationMethod::Visvalingam:
+        return rankVisvalingam(vertices, isRing);
+    }
+    throw std::logic_error("Unknown simplification method");
+}
+
+std::vector<primitives::Point> simplifyPolyline(const std::vector<primitives::Point>& polyline,
+                                                double tolerance,
+                                                SimplificationMethod method,
+                                                bool preserveTopology)
+{
+    return simplify(polyline, false, {tolerance}, method, preserveTopology).front();
+}
+
+primitives::Polygon simplifyPolygon(const primitives::Polygon& polygon,
+                                    double tolerance,
+                                    SimplificationMethod method,
+                                    bool preserveTopology)
+{
+    return primitives::Polygon(simplify(getVertices(polygon), true, {tolerance}, method, preserveTopology).front());
+}
+
+std::vector<std::vector<primitives::Point>> simplifyPolyline(const std::vector<primitives::Point>& polyline,
+                                                             const std::vector<double>& tolerances,
+                                                             SimplificationMethod method,
+                                                             bool preserveTopology)
+{
+    return simplify(polyline, false, tolerances, method, preserveTopology);
+}
+
+std::vector<primitives::Polygon> simplifyPolygon(const primitives::Polygon& polygon,
+                                                 const std::vector<double>& tolerances,
+                                                 SimplificationMethod method,
+                                                 bool preserveTopology)
+{
+    std::vector<primitives::Polygon> result;
+    for (auto& ring : simplify(getVertices(polygon), true, tolerances, method, preserveTopology))
+    {
+        result.emplace_back(ring);
+    }
+    return result;
+}
+
+} // namespace algorithms
@@ -0,0 +1,60 @@
+#ifndef SIMPLIFICATION_HPP_INCLUDED
+#define SIMPLIFICATION_HPP_INCLUDED
+
+#include <vector>
+
+#include "primitives/point.hpp"
+#include "primitives/polygon.hpp"
+
+namespace algorithms
+{
+
+enum class SimplificationMethod
+{
+    // Tolerance is a distance: A vertex is dropped if it is within the tolerance of the edge replacing it,
+    // splitting recursively at the farthest vertex.
+    DouglasPeucker,
+    // Tolerance is an area: The vertex spanning the smallest triangle with its neighbours is dropped
+    // repeatedly, as long as that area is within the tolerance.
+    Visvalingam
+};
+
+// Importance of every vertex of a polyline, or of a closed ring if isRing is set: Simplifying with any
+// tolerance keeps exactly the vertices whose importance exceeds it. The end points of a polyline and three
+// vertices of a ring have infinite importance, so they are always kept.
+//
+// Importances never increase from a vertex to the vertices whose fate is decided after it (the parts it
+// splits for Douglas-Peucker, the vertices dropped later for Visvalingam), which makes the simplifications
+// for different tolerances nested and lets all of them be read off one ranking.
+std::vector<double> rankVertices(const std::vector<primitives::Point>& vertices, bool isRing, SimplificationMethod method);
+
+// Simplifies a polyline, keeping its end points. If preserveTopology is set, vertices are put back
+// until the result doesn't intersect itself, apart from consecutive edges sharing their end point. This
+// requires the polyline itself to be free of such intersections and throws std::invalid_argument otherwise.
+std::vector<primitives::Point> simplifyPolyline(const std::vector<primitives::Point>& polyline,
+                                                double tolerance,
+                                                SimplificationMethod method,
+                                                bool preserveTopology);
+
+// Simplifies the ring of a polygon down to at least three vertices. Without preserveTopology, the Polygon
+// constructor throws if the simplified ring intersects itself.
+primitives::Polygon simplifyPolygon(const primitives::Polygon& polygon,
+                                    double tolerance,
+                                    SimplificationMethod method,
+                                    bool preserveTopology);
+
+// Same for several tolerances, e. g. one per zoom level, with the results in the order of <tolerances>.
+// All of them come from one ranking, and the result for a smaller tolerance contains every vertex of the
+// results for larger ones, including those put back to preserve topology.
+std::vector<std::vector<primitives::Point>> simplifyPolyline(const std::vector<primitives::Point>& polyline,
+                                                             const std::vector<double>& tolerances,
+                                                             SimplificationMethod method,
+                                                             bool preserveTopology);
+std::vector<primitives::Polygon> simplifyPolygon(const primitives::Polygon& polygon,
+                                                 const std::vector<double>& tolerances,
+                                                 SimplificationMethod method,
+                                                 bool preserveTopology);
+
+} // namespace algorithms
+
+#endif
@@ -1,10 +1,16 @@
 #include "executables/doctest.h"
 
 #include "algorithms/planesweep/planesweep.hpp"
+#include "utility/io.hpp"
 
+#include <array>
+#include <cmath>
+#include <cstdint>
 #include <filesystem>
 #include <fstream>
 #include <iostream>
+#include <set>
+#include <stdexcept>
 
 using namespace algorithms;
 
@@ -81,3 +87,335 @@ TEST_CASE("planesweep::perform - general case")
 
   CHECK(intersections.size() == 60);
 }
+
+TEST_CASE("planesweep::perform - index based output")
+{
+  std::vector<primitives::LineSegment> lines = {
+      primitives::LineSegment(primitives::Point(0., .1),
+                              primitives::Point(1., -.1)),
+      primitives::LineSegment(primitives::Point(0, .5),
+                              primitives::Point(0, -.5)),
+      primitives::LineSegment(primitives::Point(.5, .5),
+                              primitives::Point(.5, -.5)),
+      primitives::LineSegment(primitives::Point(1., .5),
+                              primitives::Point(1., -.5))};
+
+  Planesweep algo(lines);
+
+  std::vector<SegmentIntersection> intersections;
+  algo.perform(intersections);
+
+  REQUIRE(intersections.size() == 3);
+
+  std::vector<primitives::Point> expectedPoints = {
+      primitives::Point(0., .1), primitives::Point(.5, 0.), primitives::Point(1., -.1)};
+  for (const auto &intersection : intersections)
+  {
+    auto firstSegment = std::min(intersection.firstSegment, intersection.secondSegment);
+    auto secondSegment = std::max(intersection.firstSegment, intersection.secondSegment);
+    CHECK(firstSegment == 0);
+    REQUIRE(std::holds_alternative<primitives::Point>(intersection.intersection));
+    auto point = std::get<primitives::Point>(intersection.intersection);
+    CHECK(point.squareDistance(expectedPoints[secondSegment - 1]) < 1e-6);
+  }
+
+  // The callback receives the same records, in the same order.
+  size_t numReported = 0;
+  algo.perform([&](const SegmentIntersection &intersection)
+               {
+                 CHECK(intersection.firstSegment == intersections[numReported].firstSegment);
+                 CHECK(intersection.secondSegment == intersections[numReported].secondSegment);
+                 ++numReported; });
+  CHECK(numReported == intersections.size());
+}
+
+TEST_CASE("planesweep::findAnyIntersection - shared end points")
+{
+  auto makeClosedPolyline = [](const std::vector<primitives::Point> &vertices)
+  {
+    std::vector<primitives::LineSegment> edges;
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+      edges.push_back(primitives::LineSegment(vertices[i], vertices[(i + 1) % vertices.size()]));
+    }
+    return edges;
+  };
+
+  // Bow tie; the first and third edge cross in (1, 1).
+  Planesweep bowTie(makeClosedPolyline({primitives::Point(0., 0.), primitives::Point(2., 2.),
+                                        primitives::Point(2.5, 0.), primitives::Point(0., 2.)}));
+  for (auto sharedEndPoints : {SharedEndPoints::Allowed, SharedEndPoints::AllowedBetweenConsecutive})
+  {
+    auto crossing = bowTie.findAnyIntersection(sharedEndPoints);
+    REQUIRE(crossing.has_value());
+    CHECK(std::min(crossing->firstSegment, crossing->secondSegment) == 0);
+    CHECK(std::max(crossing->firstSegment, crossing->secondSegment) == 2);
+  }
+
+  // Simple polygon whose first and third vertex touch; only the consecutive edges share end points.
+  Planesweep quad(makeClosedPolyline({primitives::Point(0., 0.), primitives::Point(2., .3),
+                                      primitives::Point(2.2, 2.), primitives::Point(-.1, 1.8)}));
+  CHECK(!quad.findAnyIntersection(SharedEndPoints::Allowed).has_value());
+  CHECK(!quad.findAnyIntersection(SharedEndPoints::AllowedBetweenConsecutive).has_value());
+  CHECK(quad.findAnyIntersection(SharedEndPoints::Forbidden).has_value());
+
+  // Two non-consecutive segments touching in a common end point.
+  Planesweep touching({primitives::LineSegment(primitives::Point(0., 0.), primitives::Point(1., 1.)),
+                       primitives::LineSegment(primitives::Point(3., 0.), primitives::Point(4., 1.2)),
+                       primitives::LineSegment(primitives::Point(1., 1.), primitives::Point(2., -.5)),
+                       primitives::LineSegment(primitives::Point(5., 0.), primitives::Point(6., 1.1))});
+  CHECK(!touching.findAnyIntersection(SharedEndPoints::Allowed).has_value());
+  CHECK(touching.findAnyIntersection(SharedEndPoints::AllowedBetweenConsecutive).has_value());
+}
+
+TEST_CASE("planesweep::findAnyIntersection - (nearly) collinear consecutive edges")
+{
+  // The lower edge comes first, so its upper end point is processed while the upper edge is still in the
+  // status line.
+  Planesweep collinear({primitives::LineSegment(primitives::Point(0., 0.), primitives::Point(1., 2.)),
+                        primitives::LineSegment(primitives::Point(1., 2.), primitives::Point(2., 4.))});
+  CHECK(!collinear.findAnyIntersection(SharedEndPoints::Allowed).has_value());
+  CHECK(collinear.findAnyIntersection(SharedEndPoints::Forbidden).has_value());
+
+  Planesweep nearlyCollinear({primitives::LineSegment(primitives::Point(96.807119657120339, -22.98416151801014),
+                                                      primitives::Point(96.753547367846423, -22.939335233492798)),
+                              primitives::LineSegment(primitives::Point(96.753547367846423, -22.939335233492798),
+                                                      primitives::Point(96.700043183422778, -22.894565408537158))});
+  CHECK(!nearlyCollinear.findAnyIntersection(SharedEndPoints::Allowed).has_value());
+
+  // Slightly sloped edge, which is compared as a horizontal one, followed by a steeper one.
+  Planesweep slightlySloped({primitives::LineSegment(primitives::Point(76.535386412109588, 65.248855892613832),
+                                                     primitives::Point(76.527682393566209, 65.248871434107102)),
+                             primitives::LineSegment(primitives::Point(76.527682393566209, 65.248871434107102),
+                                                     primitives::Point(75.548669656780987, 65.238275077704273))});
+  CHECK(!slightlySloped.findAnyIntersection(SharedEndPoints::Allowed).has_value());
+
+  // Overlapping lines can't be ordered in the status line at all, which fails right away.
+  Planesweep overlapping({primitives::LineSegment(primitives::Point(0., 0.), primitives::Point(2., 4.)),
+                          primitives::LineSegment(primitives::Point(1., 2.), primitives::Point(3., 6.))});
+  CHECK_THROWS_AS(overlapping.perform(), std::logic_error);
+
+  // Finely subdivided wavy ring.
+  std::vector<primitives::LineSegment> edges;
+  const double pi = std::acos(-1.);
+  size_t numVertices = 20000;
+  auto getVertex = [&](size_t i)
+  {
+    double angle = 2. * pi * i / numVertices;
+    double radius = 100. + 5. * std::sin(40. * angle);
+    return primitives::Point(radius * std::cos(angle), radius * std::sin(angle));
+  };
+  for (size_t i = 0; i < numVertices; ++i)
+  {
+    edges.emplace_back(getVertex(i), getVertex((i + 1) % numVertices));
+  }
+  CHECK(!Planesweep(edges).findAnyIntersection(SharedEndPoints::AllowedBetweenConsecutive).has_value());
+}
+
+TEST_CASE("planesweep::findAnyIntersection - horizontal lines pointing left")
+{
+  // Two clockwise triangles touching in (2, 2), where a horizontal edge pointing left starts in the lower end
+  // point of the other triangle's diagonal.
+  std::vector<primitives::LineSegment> lines = {
+      primitives::LineSegment(primitives::Point(2., 1.), primitives::Point(1., 1.)),
+      primitives::LineSegment(primitives::Point(2., 2.), primitives::Point(2., 1.)),
+      primitives::LineSegment(primitives::Point(1., 1.), primitives::Point(2., 2.)),
+      primitives::LineSegment(primitives::Point(3., 2.), primitives::Point(2., 2.)),
+      primitives::LineSegment(primitives::Point(3., 3.), primitives::Point(3., 2.)),
+      primitives::LineSegment(primitives::Point(2., 2.), primitives::Point(3., 3.))};
+  CHECK(!Planesweep(lines).findAnyIntersection(SharedEndPoints::Allowed).has_value());
+
+  // The same with the horizontal edges pointing right.
+  for (auto &line : lines)
+  {
+    if (line.getStartPoint().y() == line.getEndPoint().y())
+    {
+      line = primitives::LineSegment(line.getEndPoint(), line.getStartPoint());
+    }
+  }
+  CHECK(!Planesweep(lines).findAnyIntersection(SharedEndPoints::Allowed).has_value());
+}
+
+TEST_CASE("planesweep::findAnyIntersection - agrees with perform")
+{
+  std::vector<primitives::LineSegment> lines = {
+      primitives::LineSegment(primitives::Point(0., 0.),
+                              primitives::Point(1., 3.)),
+      primitives::LineSegment(primitives::Point(2., 0.5),
+                              primitives::Point(3., 2.)),
+      primitives::LineSegment(primitives::Point(-1., 2.),
+                              primitives::Point(.5, 2.5))};
+
+  Planesweep algo(lines);
+  CHECK(algo.perform().empty());
+  CHECK(!algo.findAnyIntersection().has_value());
+
+  algo.m_lines.push_back(primitives::LineSegment(primitives::Point(-1., 1.2), primitives::Point(4., 1.3)));
+  CHECK(algo.perform().size() == 2);
+  auto intersection = algo.findAnyIntersection();
+  REQUIRE(intersection.has_value());
+  CHECK(std::max(intersection->firstSegment, intersection->secondSegment) == 3);
+  CHECK(std::holds_alternative<primitives::Point>(intersection->intersection));
+}
+
+TEST_CASE("RedBluePlanesweep::perform - only bichromatic intersections")
+{
+  // Red layer: three roughly horizontal polylines, blue layer: three roughly vertical
+  // polylines. Neither layer crosses itself, but consecutive segments share end points.
+  std::vector<primitives::LineSegment> redLines;
+  std::vector<primitives::LineSegment> blueLines;
+  for (int i = 0; i < 3; ++i)
+  {
+    for (int j = 0; j < 4; ++j)
+    {
+      redLines.push_back(primitives::LineSegment(primitives::Point(j - .05, i + .1 * (j % 2) + .03),
+                                                 primitives::Point(j + 1 - .05, i + .1 * ((j + 1) % 2) + .03)));
+      blueLines.push_back(primitives::LineSegment(primitives::Point(i + .5 + .07 * (j % 2), j - .5),
+                                                  primitives::Point(i + .5 + .07 * ((j + 1) % 2), j + .5)));
+    }
+  }
+
+  std::set<std::pair<size_t, size_t>> expected;
+  for (size_t i = 0; i < redLines.size(); ++i)
+  {
+    for (size_t j = 0; j < blueLines.size(); ++j)
+    {
+      if (redLines[i].intersects(blueLines[j]))
+      {
+        expected.insert({i, j});
+      }
+    }
+  }
+  REQUIRE(expected.size() == 9);
+
+  RedBluePlanesweep algo(redLines, blueLines);
+  for (bool layersAreCrossingFree : {false, true})
+  {
+    std::vector<SegmentIntersection> intersections;
+    algo.perform(intersections, layersAreCrossingFree);
+
+    std::set<std::pair<size_t, size_t>> found;
+    for (const auto &intersection : intersections)
+    {
+      found.insert({intersection.firstSegment, intersection.secondSegment});
+      REQUIRE(std::holds_alternative<primitives::Point>(intersection.intersection));
+      const auto &point = std::get<primitives::Point>(intersection.intersection);
+      CHECK(projectPointOnLine(point, redLines[intersection.firstSegment]).squareDistance(point) < 1e-12);
+      CHECK(projectPointOnLine(point, blueLines[intersection.secondSegment]).squareDistance(point) < 1e-12);
+    }
+    CHECK(intersections.size() == found.size());
+    CHECK(found == expected);
+  }
+}
+
+TEST_CASE("planesweep::performParallel - agrees with brute force")
+{
+  // Two families of parallel lines crossing each other, many of them in end points of
+  // other lines, which also end up on slab boundaries.
+  std::vector<primitives::LineSegment> lines;
+  for (int k = 0; k < 12; ++k)
+  {
+    lines.push_back(primitives::LineSegment(primitives::Point(0., k * .7),
+                                            primitives::Point(10., 5. + k * .7)));
+    lines.push_back(primitives::LineSegment(primitives::Point(.3 * k, 12.),
+                                            primitives::Point(3. + .3 * k, -1.)));
+  }
+
+  std::set<std::pair<size_t, size_t>> expected;
+  for (size_t i = 0; i < lines.size(); ++i)
+  {
+    for (size_t j = i + 1; j < lines.size(); ++j)
+    {
+      if (lines[i].intersects(lines[j]))
+      {
+        expected.insert({i, j});
+      }
+    }
+  }
+
+  Planesweep algo(lines);
+  for (size_t numThreads : {1, 3, 8})
+  {
+    std::vector<SegmentIntersection> intersections;
+    algo.performParallel(intersections, numThreads);
+
+    std::set<std::pair<size_t, size_t>> found;
+    for (const auto &intersection : intersections)
+    {
+      CHECK(intersection.firstSegment < intersection.secondSegment);
+      found.insert({intersection.firstSegment, intersection.secondSegment});
+    }
+    CHECK(intersections.size() == found.size());
+    CHECK(found == expected);
+  }
+}
+
+TEST_CASE("StreamingPlanesweep::perform - agrees with perform")
+{
+  // Short segments spread along a tall strip, so only a few cross the sweep line at any time.
+  std::vector<primitives::LineSegment> lines;
+  for (size_t i = 0; i < 400; ++i)
+  {
+    double x = std::fmod(i * 3.7123, 10.);
+    double y = std::fmod(i * 61.7654, 400.);
+    lines.push_back(primitives::LineSegment(primitives::Point(x, y),
+                                            primitives::Point(x + 2. * std::cos(i * 2.4), y + 2. * std::sin(i * 2.4))));
+  }
+
+  std::set<std::pair<size_t, size_t>> expected;
+  std::vector<SegmentIntersection> intersections;
+  Planesweep(lines).perform(intersections);
+  for (const auto &intersection : intersections)
+  {
+    expected.insert({std::min(intersection.firstSegment, intersection.secondSegment),
+                     std::max(intersection.firstSegment, intersection.secondSegment)});
+  }
+  REQUIRE(expected.size() > 20);
+
+  auto filePath = std::filesystem::temp_directory_path() / "jumjum-streaming-planesweep.bin";
+  auto fileOrder = utility::writeLineSegmentsToBinaryFile(lines, filePath);
+  REQUIRE(fileOrder.size() == lines.size());
+
+  utility::LineSegmentFileReader reader(filePath);
+  CHECK(reader.getNumLines() == lines.size());
+  for (size_t i = 0; i < fileOrder.size(); ++i)
+  {
+    auto line = reader.readNext();
+    REQUIRE(line.has_value());
+    CHECK(*line == lines[fileOrder[i]]);
+  }
+  CHECK(!reader.readNext().has_value());
+
+  StreamingPlanesweep streamingSweep(filePath);
+  std::set<std::pair<size_t, size_t>> found;
+  size_t numReported = 0;
+  streamingSweep.perform([&](const SegmentIntersection &intersection)
+                         {
+                           size_t first = fileOrder[intersection.firstSegment];
+                           size_t second = fileOrder[intersection.secondSegment];
+                           found.insert({std::min(first, second), std::max(first, second)});
+                           ++numReported; });
+  CHECK(numReported == intersections.size());
+  CHECK(found == expected);
+  CHECK(streamingSweep.getPeakNumActiveLines() < lines.size() / 10);
+
+  std::filesystem::remove(filePath);
+}
+
+TEST_CASE("StreamingPlanesweep::perform - unsorted file")
+{
+  auto filePath = std::filesystem::temp_directory_path() / "jumjum-unsorted-lines.bin";
+  {
+    std::ofstream file(filePath, std::ios::binary);
+    uint64_t numLines = 2;
+    std::array<double, 8> records = {0., 0., 1., -1., 0., 5., 1., 4.};
+    file.write("JJLS", 4);
+    file.write(reinterpret_cast<const char *>(&numLines), sizeof(numLines));
+    file.write(reinterpret_cast<const char *>(records.data()), sizeof(double) * records.size());
+  }
+
+  StreamingPlanesweep streamingSweep(filePath);
+  CHECK_THROWS_AS(streamingSweep.perform([](const SegmentIntersection &) {}), std::runtime_error);
+
+  std::filesystem::remove(filePath);
+}
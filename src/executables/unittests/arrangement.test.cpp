@@ -0,0 +1,168 @@
+#include "executables/doctest.h"
+
+#include "algorithms/planesweep/arrangement.hpp"
+
+#include <algorithm>
+
+using namespace algorithms;
+using primitives::LineSegment;
+using primitives::Point;
+
+namespace
+{
+
+std::vector<LineSegment> getClosedPolyline(const std::vector<Point>& vertices)
+{
+    std::vector<LineSegment> edges;
+    for (size_t i = 0; i < vertices.size(); ++i)
+    {
+        edges.push_back(LineSegment(vertices[i], vertices[(i + 1) % vertices.size()]));
+    }
+    return edges;
+}
+
+// Checks the DCEL invariants every arrangement must satisfy.
+void checkConsistency(const Arrangement& arrangement)
+{
+    for (size_t h = 0; h < arrangement.getNumHalfEdges(); ++h)
+    {
+        size_t next = arrangement.halfEdgeNext[h];
+        CHECK(arrangement.halfEdgePrev[next] == h);
+        CHECK(arrangement.getTarget(h) == arrangement.halfEdgeOrigins[next]);
+        CHECK(arrangement.halfEdgeFaces[next] == arrangement.halfEdgeFaces[h]);
+    }
+    for (size_t v = 0; v < arrangement.vertices.size(); ++v)
+    {
+        CHECK(arrangement.halfEdgeOrigins[arrangement.vertexHalfEdges[v]] == v);
+    }
+
+    CHECK(arrangement.faceOuterHalfEdges[0] == NoHalfEdge);
+    for (size_t f = 1; f < arrangement.getNumFaces(); ++f)
+    {
+        CHECK(arrangement.halfEdgeFaces[arrangement.faceOuterHalfEdges[f]] == f);
+        CHECK(arrangement.getBoundaryArea(arrangement.faceOuterHalfEdges[f]) > 0.);
+    }
+    for (size_t f = 0; f < arrangement.getNumFaces(); ++f)
+    {
+        for (size_t i = arrangement.faceHoleOffsets[f]; i < arrangement.faceHoleOffsets[f + 1]; ++i)
+        {
+            CHECK(arrangement.halfEdgeFaces[arrangement.faceHoleHalfEdges[i]] == f);
+            CHECK(arrangement.getBoundaryArea(arrangement.faceHoleHalfEdges[i]) <= 0.);
+        }
+    }
+}
+
+} // namespace
+
+TEST_CASE("computeArrangement - square with diagonals")
+{
+    auto segments = getClosedPolyline({Point(0., 0.), Point(2., 0.), Point(2., 2.), Point(0., 2.)});
+    segments.push_back(LineSegment(Point(0., 0.), Point(2., 2.)));
+    segments.push_back(LineSegment(Point(2., 0.), Point(0., 2.)));
+
+    auto arrangement = computeArrangement(segments);
+    checkConsistency(arrangement);
+
+    CHECK(arrangement.vertices.size() == 5);
+    CHECK(arrangement.getNumEdges() == 8);
+    REQUIRE(arrangement.getNumFaces() == 5);
+    for (size_t f = 1; f < 5; ++f)
+    {
+        CHECK(arrangement.getBoundaryArea(arrangement.faceOuterHalfEdges[f]) == doctest::Approx(1.));
+        CHECK(arrangement.getBoundaryVertices(arrangement.faceOuterHalfEdges[f]).size() == 3);
+    }
+
+    // The outer boundary is the only hole of the unbounded face.
+    REQUIRE(arrangement.faceHoleOffsets[1] - arrangement.faceHoleOffsets[0] == 1);
+    CHECK(arrangement.getBoundaryArea(arrangement.faceHoleHalfEdges[0]) == doctest::Approx(-4.));
+
+    // Every edge lies on exactly one input segment, and the diagonals are split in the middle.
+    for (size_t e = 0; e < arrangement.getNumEdges(); ++e)
+    {
+        CHECK(arrangement.edgeSegmentOffsets[e + 1] - arrangement.edgeSegmentOffsets[e] == 1);
+    }
+    CHECK(std::count(arrangement.edgeSegments.begin(), arrangement.edgeSegments.end(), 4) == 2);
+}
+
+TEST_CASE("computeArrangement - nested components and overlapping segments")
+{
+    auto segments = getClosedPolyline({Point(0., 0.), Point(10., 0.), Point(10., 10.), Point(0., 10.)});
+    auto inner = getClosedPolyline({Point(3., 3.), Point(6., 3.3), Point(6.2, 6.), Point(3.1, 5.8)});
+    segments.insert(segments.end(), inner.begin(), inner.end());
+    // Dangling segment inside the inner face, and a segment overlapping part of the bottom edge.
+    segments.push_back(LineSegment(Point(4., 4.), Point(5., 4.5)));
+    segments.push_back(LineSegment(Point(2., 0.), Point(5., 0.)));
+
+    auto arrangement = computeArrangement(segments);
+    checkConsistency(arrangement);
+
+    // Outer square, inner quadrilateral, unbounded face.
+    REQUIRE(arrangement.getNumFaces() == 3);
+    size_t outerFace = 0;
+    size_t innerFace = 0;
+    for (size_t f = 1; f < 3; ++f)
+    {
+        double area = arrangement.getBoundaryArea(arrangement.faceOuterHalfEdges[f]);
+        (area > 50. ? outerFace : innerFace) = f;
+    }
+    REQUIRE(outerFace != innerFace);
+
+    CHECK(arrangement.faceHoleOffsets[outerFace + 1] - arrangement.faceHoleOffsets[outerFace] == 1);
+    CHECK(arrangement.faceHoleOffsets[innerFace + 1] - arrangement.faceHoleOffsets[innerFace] == 1);
+    size_t danglingHole = arrangement.faceHoleHalfEdges[arrangement.faceHoleOffsets[innerFace]];
+    CHECK(arrangement.getBoundaryArea(danglingHole) == doctest::Approx(0.));
+    CHECK(arrangement.getBoundaryVertices(danglingHole).size() == 2);
+
+    // The bottom edge is split at 2 and 5, the middle part lying on both segments.
+    size_t numSharedEdges = 0;
+    for (size_t e = 0; e < arrangement.getNumEdges(); ++e)
+    {
+        if (arrangement.edgeSegmentOffsets[e + 1] - arrangement.edgeSegmentOffsets[e] == 2)
+        {
+            ++numSharedEdges;
+            CHECK(arrangement.edgeSegments[arrangement.edgeSegmentOffsets[e]] == 0);
+            CHECK(arrangement.edgeSegments[arrangement.edgeSegmentOffsets[e] + 1] == 9);
+        }
+    }
+    CHECK(numSharedEdges == 1);
+    CHECK(arrangement.vertices.size() == 4 + 4 + 2 + 2);
+}
+
+TEST_CASE("computeArrangement - road grid")
+{
+    // 4 x 4 grid of roads sticking out at both ends, i. e., 9 blocks.
+    std::vector<LineSegment> segments;
+    for (int i = 0; i < 4; ++i)
+    {
+        segments.push_back(LineSegment(Point(-1., i + .01 * i), Point(4., i - .02 * i)));
+        segments.push_back(LineSegment(Point(i + .03 * i, -1.), Point(i - .01 * i, 4.)));
+    }
+
+    auto arrangement = computeArrangement(segments, 2);
+    checkConsistency(arrangement);
+
+    CHECK(arrangement.vertices.size() == 16 + 16);
+    CHECK(arrangement.getNumEdges() == 8 * 5);
+    // Euler: V - E + F = 1 + number of connected components.
+    CHECK(arrangement.vertices.size() - arrangement.getNumEdges() + arrangement.getNumFaces() == 2);
+    CHECK(arrangement.getNumFaces() == 10);
+}
+
+TEST_CASE("computeArrangement - hole whose ray hits a vertex")
+{
+    // The ray to the left from the hole's leftmost vertex (4, 5) passes exactly through the notch at (1, 5).
+    auto segments = getClosedPolyline({Point(0., 0.), Point(10., 0.), Point(10., 10.), Point(0., 10.), Point(1., 5.)});
+    auto hole = getClosedPolyline({Point(4., 5.), Point(6., 4.), Point(7., 6.)});
+    segments.insert(segments.end(), hole.begin(), hole.end());
+
+    auto arrangement = computeArrangement(segments);
+    checkConsistency(arrangement);
+
+    REQUIRE(arrangement.getNumFaces() == 3);
+    for (size_t f = 1; f < 3; ++f)
+    {
+        bool isOuterPolygon = arrangement.getBoundaryArea(arrangement.faceOuterHalfEdges[f]) > 50.;
+        CHECK(arrangement.faceHoleOffsets[f + 1] - arrangement.faceHoleOffsets[f] == (isOuterPolygon ? 1 : 0));
+    }
+    CHECK(arrangement.faceHoleOffsets[1] - arrangement.faceHoleOffsets[0] == 1);
+}
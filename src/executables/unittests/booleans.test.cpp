@@ -0,0 +1,104 @@
+#include "executables/doctest.h"
+
+#include "algorithms/planesweep/booleans.hpp"
+
+using namespace algorithms;
+using primitives::Point;
+using primitives::Polygon;
+using primitives::PolygonWithHoles;
+
+namespace
+{
+
+Polygon getRectangle(double minX, double minY, double maxX, double maxY)
+{
+    return Polygon({Point(minX, minY), Point(maxX, minY), Point(maxX, maxY), Point(minX, maxY)});
+}
+
+double getTotalArea(const std::vector<PolygonWithHoles>& polygons)
+{
+    double area = 0.;
+    for (const auto& polygon : polygons)
+    {
+        CHECK(polygon.outer.getSignedArea() > 0.);
+        area += polygon.outer.getSignedArea();
+        for (const auto& hole : polygon.holes)
+        {
+            CHECK(hole.getSignedArea() < 0.);
+            area += hole.getSignedArea();
+        }
+    }
+    return area;
+}
+
+} // namespace
+
+TEST_CASE("computeBooleanOperation - two overlapping squares")
+{
+    std::vector<Polygon> first = {getRectangle(0., 0., 2., 2.)};
+    // Clockwise on purpose.
+    std::vector<Polygon> second = {Polygon({Point(1., 1.), Point(1., 3.), Point(3., 3.), Point(3., 1.)})};
+
+    auto unionResult = computeBooleanOperation(first, second, BooleanOperation::Union);
+    REQUIRE(unionResult.size() == 1);
+    CHECK(unionResult[0].outer.size() == 8);
+    CHECK(unionResult[0].holes.empty());
+    CHECK(getTotalArea(unionResult) == doctest::Approx(7.));
+
+    auto intersectionResult = computeBooleanOperation(first, second, BooleanOperation::Intersection);
+    REQUIRE(intersectionResult.size() == 1);
+    CHECK(intersectionResult[0].outer.size() == 4);
+    CHECK(getTotalArea(intersectionResult) == doctest::Approx(1.));
+
+    auto differenceResult = computeBooleanOperation(first, second, BooleanOperation::Difference);
+    REQUIRE(differenceResult.size() == 1);
+    CHECK(differenceResult[0].outer.size() == 6);
+    CHECK(getTotalArea(differenceResult) == doctest::Approx(3.));
+
+    // The two differences only touch in (1, 2) and (2, 1).
+    auto symmetricDifferenceResult = computeBooleanOperation(first, second, BooleanOperation::SymmetricDifference);
+    CHECK(symmetricDifferenceResult.size() == 2);
+    CHECK(getTotalArea(symmetricDifferenceResult) == doctest::Approx(6.));
+}
+
+TEST_CASE("computeBooleanOperation - holes")
+{
+    std::vector<Polygon> frame = {getRectangle(0., 0., 10., 10.)};
+    std::vector<Polygon> window = {getRectangle(2., 2., 4., 4.)};
+
+    auto difference = computeBooleanOperation(frame, window, BooleanOperation::Difference);
+    REQUIRE(difference.size() == 1);
+    CHECK(difference[0].holes.size() == 1);
+    CHECK(getTotalArea(difference) == doctest::Approx(96.));
+
+    // Results can be fed back in.
+    std::vector<PolygonWithHoles> mask = {{getRectangle(3., 3., 5., 5.), {}}};
+    auto clipped = computeBooleanOperation(difference, mask, BooleanOperation::Intersection, 2);
+    REQUIRE(clipped.size() == 1);
+    CHECK(clipped[0].outer.size() == 6);
+    CHECK(getTotalArea(clipped) == doctest::Approx(3.));
+
+    // A hole touching the outer boundary in a vertex stays a hole.
+    std::vector<Polygon> diamond = {Polygon({Point(0., 5.), Point(2., 3.), Point(4., 5.), Point(2., 7.)})};
+    auto touching = computeBooleanOperation(frame, diamond, BooleanOperation::Difference);
+    REQUIRE(touching.size() == 1);
+    CHECK(touching[0].outer.size() == 4);
+    CHECK(touching[0].holes.size() == 1);
+    CHECK(getTotalArea(touching) == doctest::Approx(92.));
+}
+
+TEST_CASE("computeBooleanOperation - polygon sets")
+{
+    // Overlapping polygons of the same set are merged.
+    std::vector<Polygon> first = {getRectangle(0., 0., 2., 2.), getRectangle(1., 1., 3., 3.), getRectangle(5., 0., 6., 1.)};
+    auto merged = computeBooleanOperation(first, {}, BooleanOperation::Union);
+    CHECK(merged.size() == 2);
+    CHECK(getTotalArea(merged) == doctest::Approx(8.));
+
+    CHECK(computeBooleanOperation(first, {getRectangle(10., 10., 11., 11.)}, BooleanOperation::Intersection).empty());
+    CHECK(computeBooleanOperation(first, first, BooleanOperation::SymmetricDifference).empty());
+
+    auto clipped = computeBooleanOperation(first, {getRectangle(1.5, -1., 5.5, .5)}, BooleanOperation::Intersection);
+    CHECK(clipped.size() == 2);
+    CHECK(getTotalArea(clipped) == doctest::Approx(.25 + .25));
+}
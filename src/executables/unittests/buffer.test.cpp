@@ -0,0 +1,185 @@
+#include "executables/doctest.h"
+
+#include "algorithms/planesweep/buffer.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace algorithms;
+using primitives::Point;
+using primitives::Polygon;
+using primitives::PolygonWithHoles;
+
+namespace
+{
+
+const double pi = std::acos(-1.);
+
+double getArea(const std::vector<PolygonWithHoles>& polygons)
+{
+    double area = 0.;
+    for (const auto& polygon : polygons)
+    {
+        area += std::abs(polygon.outer.getSignedArea());
+        for (const auto& hole : polygon.holes)
+        {
+            area -= std::abs(hole.getSignedArea());
+        }
+    }
+    return area;
+}
+
+BufferStyle getStyle(JoinType joinType, EndCap endCap = EndCap::Round)
+{
+    BufferStyle style;
+    style.joinType = joinType;
+    style.endCap = endCap;
+    return style;
+}
+
+} // namespace
+
+TEST_CASE("bufferPolygon - square")
+{
+    Polygon square({Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10)});
+
+    // Round joins approximate quarter circles from inside, by default within a hundredth of the distance.
+    auto round = bufferPolygon(square, 1.);
+    REQUIRE(round.size() == 1);
+    CHECK(round[0].holes.empty());
+    CHECK(getArea(round) < 140. + pi);
+    CHECK(getArea(round) > 140. + pi - 2. * pi * .01);
+    BufferStyle fine;
+    fine.arcTolerance = 1e-5;
+    CHECK(getArea(bufferPolygon(square, 1., fine)) == doctest::Approx(140. + pi));
+    CHECK(round[0].outer.contains(Point(10.7, 10.7)));
+    CHECK(!round[0].outer.contains(Point(10.8, 10.8)));
+
+    CHECK(getArea(bufferPolygon(square, 1., getStyle(JoinType::Mitre))) == doctest::Approx(144.));
+    // Squared off at distance 1 from the corners, i. e. missing 4 triangles of area (sqrt(2) - 1)^2.
+    CHECK(getArea(bufferPolygon(square, 1., getStyle(JoinType::Square))) == doctest::Approx(144. - 4. * (3. - 2. * std::sqrt(2.))));
+
+    // Right angles are within the default mitre limit of 2, but not within 1.2.
+    auto limited = getStyle(JoinType::Mitre);
+    limited.mitreLimit = 1.2;
+    CHECK(getArea(bufferPolygon(square, 1., limited)) < 144.);
+
+    // Counterclockwise and clockwise input give the same result.
+    Polygon clockwise({Point(0, 0), Point(0, 10), Point(10, 10), Point(10, 0)});
+    CHECK(getArea(bufferPolygon(clockwise, 1.)) == doctest::Approx(getArea(round)));
+
+    for (auto joinType : {JoinType::Mitre, JoinType::Round, JoinType::Square})
+    {
+        CHECK(getArea(bufferPolygon(square, -2., getStyle(joinType))) == doctest::Approx(36.));
+        CHECK(bufferPolygon(square, -5.5, getStyle(joinType)).empty());
+    }
+    CHECK(getArea(bufferPolygon(square, 0.)) == doctest::Approx(100.));
+}
+
+TEST_CASE("bufferPolygon - concave polygons")
+{
+    // U-shape with a bay of width 2, which the outward buffer fills.
+    Polygon uShape({Point(0, 0), Point(6, 0), Point(6, 6), Point(4, 6), Point(4, 2), Point(2, 2), Point(2, 6), Point(0, 6)});
+    auto filled = bufferPolygon(uShape, 1.5, getStyle(JoinType::Mitre));
+    REQUIRE(filled.size() == 1);
+    CHECK(filled[0].holes.empty());
+    CHECK(getArea(filled) == doctest::Approx(9. * 9.));
+
+    // A narrower buffer leaves a slot of width 1 in the bay.
+    auto slotted = bufferPolygon(uShape, .5, getStyle(JoinType::Mitre));
+    REQUIRE(slotted.size() == 1);
+    CHECK(getArea(slotted) == doctest::Approx(7. * 7. - 1. * 4.));
+
+    // Shrinking narrows the arms from width 2 to 1 and widens the bay.
+    auto shrunk = bufferPolygon(uShape, -.5, getStyle(JoinType::Mitre));
+    REQUIRE(shrunk.size() == 1);
+    CHECK(getArea(shrunk) == doctest::Approx(5. * 5. - 3. * 4.));
+
+    // Dumbbell whose handle of width 1 vanishes when shrinking by more than 0.5, splitting it in two.
+    Polygon dumbbell({Point(0, 0), Point(4, 0), Point(4, 1.5), Point(6, 1.5), Point(6, 0), Point(10, 0),
+                      Point(10, 4), Point(6, 4), Point(6, 2.5), Point(4, 2.5), Point(4, 4), Point(0, 4)});
+    CHECK(bufferPolygon(dumbbell, -.25).size() == 1);
+    auto split = bufferPolygon(dumbbell, -.75, getStyle(JoinType::Mitre));
+    REQUIRE(split.size() == 2);
+    CHECK(getArea(split) == doctest::Approx(2. * 2.5 * 2.5));
+}
+
+TEST_CASE("bufferPolygon - holes")
+{
+    PolygonWithHoles frame{Polygon({Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10)}),
+                           {Polygon({Point(3, 3), Point(7, 3), Point(7, 7), Point(3, 7)})}};
+
+    // Growing the polygon shrinks the hole.
+    auto grown = bufferPolygon(frame, 1., getStyle(JoinType::Mitre));
+    REQUIRE(grown.size() == 1);
+    REQUIRE(grown[0].holes.size() == 1);
+    CHECK(getArea(grown) == doctest::Approx(144. - 4.));
+
+    // Until it is closed.
+    auto closed = bufferPolygon(frame, 2.5, getStyle(JoinType::Mitre));
+    REQUIRE(closed.size() == 1);
+    CHECK(closed[0].holes.empty());
+
+    // Shrinking the polygon grows the hole, with round joins around its corners.
+    auto shrunk = bufferPolygon(frame, -1.);
+    REQUIRE(shrunk.size() == 1);
+    REQUIRE(shrunk[0].holes.size() == 1);
+    CHECK(getArea(shrunk) > 64. - 32. - pi);
+    CHECK(getArea(shrunk) < 64. - 32. - pi + 2. * pi * .01);
+}
+
+TEST_CASE("bufferPolyline")
+{
+    std::vector<Point> segment = {Point(0, 0), Point(10, 0)};
+    CHECK(getArea(bufferPolyline(segment, 1., getStyle(JoinType::Round, EndCap::Butt))) == doctest::Approx(20.));
+    CHECK(getArea(bufferPolyline(segment, 1., getStyle(JoinType::Round, EndCap::Square))) == doctest::Approx(24.));
+    auto fine = getStyle(JoinType::Round);
+    fine.arcTolerance = 1e-5;
+    CHECK(getArea(bufferPolyline(segment, 1., fine)) == doctest::Approx(20. + pi));
+
+    // Repeated points are ignored, and the inner side of the bend is not cut.
+    std::vector<Point> bent = {Point(0, 0), Point(10, 0), Point(10, 0), Point(10, 10)};
+    auto bentBuffer = bufferPolyline(bent, 1., getStyle(JoinType::Mitre, EndCap::Butt));
+    REQUIRE(bentBuffer.size() == 1);
+    CHECK(getArea(bentBuffer) == doctest::Approx(11. * 2. + 9. * 2.));
+    CHECK(bentBuffer[0].outer.contains(Point(9.5, .5)));
+
+    // A polyline closing a loop encloses a hole, and buffers of overlapping parts merge.
+    std::vector<Point> loop = {Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10), Point(0, -5)};
+    auto loopBuffer = bufferPolyline(loop, 1., getStyle(JoinType::Mitre, EndCap::Butt));
+    REQUIRE(loopBuffer.size() == 1);
+    REQUIRE(loopBuffer[0].holes.size() == 1);
+    CHECK(std::abs(loopBuffer[0].holes[0].getSignedArea()) == doctest::Approx(64.));
+    CHECK(getArea(loopBuffer) == doctest::Approx(12. * 12. - 64. + 2. * 4.));
+
+    CHECK_THROWS_AS(bufferPolyline(segment, 0.), std::invalid_argument);
+    CHECK_THROWS_AS(bufferPolyline(segment, -1.), std::invalid_argument);
+    CHECK_THROWS_AS(bufferPolyline({Point(1, 1), Point(1, 1)}, 1.), std::invalid_argument);
+}
+
+TEST_CASE("bufferPolygon - finely subdivided boundary")
+{
+    // Wavy ring whose inward offset collapses in the tight bends, with consecutive edges nearly collinear.
+    std::vector<Point> vertices;
+    size_t numVertices = 5000;
+    for (size_t i = 0; i < numVertices; ++i)
+    {
+        double angle = 2. * pi * i / numVertices;
+        double radius = 100. + 5. * std::sin(40. * angle);
+        vertices.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+    }
+    Polygon wavy(vertices);
+
+    for (double distance : {-2., 2.})
+    {
+        auto buffer = bufferPolygon(wavy, distance, {}, 2);
+        REQUIRE(buffer.size() == 1);
+        CHECK(buffer[0].holes.empty());
+        // Between the disks of the smallest and largest radius of the wave, moved by the distance.
+        double area = getArea(buffer);
+        CHECK(area > pi * (95. + distance) * (95. + distance));
+        CHECK(area < pi * (105. + distance) * (105. + distance));
+        CHECK(buffer[0].outer.contains(Point(0, 94.9 + distance)));
+        CHECK(!buffer[0].outer.contains(Point(0, 105.1 + distance)));
+    }
+}
@@ -0,0 +1,102 @@
+#include "executables/doctest.h"
+
+#include "algorithms/hull/convexhull.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace algorithms;
+using primitives::Point;
+
+namespace
+{
+
+bool isSame(const std::vector<Point>& lhs, const std::vector<Point>& rhs)
+{
+    if (lhs.size() != rhs.size()) return false;
+    for (size_t i = 0; i < lhs.size(); ++i)
+    {
+        if (lhs[i].x() != rhs[i].x() || lhs[i].y() != rhs[i].y()) return false;
+    }
+    return true;
+}
+
+// Checks that <hull> turns left at every vertex and that no point is to its right.
+void checkIsConvexHull(const std::vector<Point>& hull, const std::vector<Point>& points)
+{
+    auto getSide = [](const Point& from, const Point& to, const Point& point)
+    {
+        return (to.x() - from.x()) * (point.y() - from.y()) - (to.y() - from.y()) * (point.x() - from.x());
+    };
+    for (size_t i = 0; i < hull.size(); ++i)
+    {
+        const auto& from = hull[i];
+        const auto& to = hull[(i + 1) % hull.size()];
+        CHECK(getSide(from, to, hull[(i + 2) % hull.size()]) > 0.);
+        bool isAnyPointRight = std::any_of(points.begin(), points.end(), [&](const Point& point) { return getSide(from, to, point) < 0.; });
+        CHECK(!isAnyPointRight);
+    }
+}
+
+} // namespace
+
+TEST_CASE("computeConvexHull")
+{
+    // Square with points inside, on its edges and repeated corners.
+    std::vector<Point> points = {Point(1, 1), Point(0, 0), Point(2, 0), Point(1, 0), Point(2, 2), Point(0, 2),
+                                 Point(.5, 1.5), Point(2, 0), Point(0, 1), Point(2, 2), Point(1, 2)};
+    auto hull = computeConvexHull(points);
+    CHECK(isSame(hull, {Point(0, 0), Point(2, 0), Point(2, 2), Point(0, 2)}));
+    checkIsConvexHull(hull, points);
+
+    CHECK(computeConvexHull({}).empty());
+    CHECK(isSame(computeConvexHull({Point(1, 1), Point(1, 1)}), {Point(1, 1)}));
+    CHECK(isSame(computeConvexHull({Point(2, 2), Point(0, 0), Point(1, 1), Point(3, 3)}), {Point(0, 0), Point(3, 3)}));
+}
+
+TEST_CASE("computeConvexHullParallel")
+{
+    std::mt19937 generator(47);
+    std::uniform_real_distribution<double> distribution(-1., 1.);
+    std::normal_distribution<double> normalDistribution(0., 10.);
+
+    std::vector<Point> square;
+    std::vector<Point> disk;
+    std::vector<Point> cloud;
+    for (int i = 0; i < 20000; ++i)
+    {
+        square.emplace_back(distribution(generator), distribution(generator));
+        Point point(distribution(generator), distribution(generator));
+        if (point.squareNorm() <= 1.) disk.push_back(point);
+        cloud.emplace_back(normalDistribution(generator), normalDistribution(generator));
+    }
+    // Points on a circle are all hull vertices.
+    std::vector<Point> circle;
+    for (int i = 0; i < 1000; ++i)
+    {
+        double angle = 2. * std::acos(-1.) * i / 1000;
+        circle.emplace_back(std::cos(angle), std::sin(angle));
+    }
+
+    for (const auto* points : {&square, &disk, &cloud, &circle})
+    {
+        auto hull = computeConvexHull(*points);
+        checkIsConvexHull(hull, *points);
+        for (size_t numThreads : {1, 3, 8})
+        {
+            CHECK(isSame(computeConvexHullParallel(*points, numThreads), hull));
+        }
+    }
+    CHECK(computeConvexHull(circle).size() == circle.size());
+
+    // Degenerate clouds.
+    CHECK(computeConvexHullParallel({}, 4).empty());
+    CHECK(isSame(computeConvexHullParallel({Point(1, 1)}, 4), {Point(1, 1)}));
+    std::vector<Point> line;
+    for (int i = 0; i < 100; ++i)
+    {
+        line.emplace_back((i * 37) % 100, 0.);
+    }
+    CHECK(isSame(computeConvexHullParallel(line, 4), {Point(0, 0), Point(99, 0)}));
+}
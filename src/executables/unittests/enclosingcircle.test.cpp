@@ -0,0 +1,137 @@
+#include "executables/doctest.h"
+
+#include "algorithms/hull/enclosingcircle.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+using namespace algorithms;
+using primitives::Circle;
+using primitives::Point;
+
+namespace
+{
+
+bool isEnclosing(const Circle& circle, const std::vector<Point>& points)
+{
+    return std::all_of(points.begin(), points.end(), [&circle](const Point& point)
+    {
+        return circle.getCenter().distance(point) <= circle.getRadius() * (1. + 1e-9);
+    });
+}
+
+Circle getCircumcircle(const Point& p1, const Point& p2, const Point& p3)
+{
+    double a = p1.squareNorm();
+    double b = p2.squareNorm();
+    double c = p3.squareNorm();
+    double denominator = 2. * (p1.x() * (p2.y() - p3.y()) + p2.x() * (p3.y() - p1.y()) + p3.x() * (p1.y() - p2.y()));
+    Point center((a * (p2.y() - p3.y()) + b * (p3.y() - p1.y()) + c * (p1.y() - p2.y())) / denominator,
+                 (a * (p3.x() - p2.x()) + b * (p1.x() - p3.x()) + c * (p2.x() - p1.x())) / denominator);
+    return Circle(center, center.distance(p1));
+}
+
+// Radius of the smallest enclosing circle, found as the smallest enclosing circle through two or three points.
+double computeRadiusByBruteForce(const std::vector<Point>& points)
+{
+    double minRadius = std::numeric_limits<double>::infinity();
+    auto tryCircle = [&](const Circle& circle)
+    {
+        if (circle.getRadius() < minRadius && isEnclosing(circle, points)) minRadius = circle.getRadius();
+    };
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        for (size_t j = i + 1; j < points.size(); ++j)
+        {
+            Point center((points[i].x() + points[j].x()) / 2., (points[i].y() + points[j].y()) / 2.);
+            tryCircle(Circle(center, points[i].distance(points[j]) / 2.));
+            for (size_t k = j + 1; k < points.size(); ++k)
+            {
+                tryCircle(getCircumcircle(points[i], points[j], points[k]));
+            }
+        }
+    }
+    return minRadius;
+}
+
+} // namespace
+
+TEST_CASE("computeMinimumEnclosingCircle")
+{
+    auto single = computeMinimumEnclosingCircle({Point(1, 2)});
+    CHECK(single.getRadius() == 0.);
+    CHECK(single.getCenter().distance(Point(1, 2)) == 0.);
+
+    // Determined by the two points farthest apart, with duplicates and collinear points.
+    auto pair = computeMinimumEnclosingCircle({Point(0, 0), Point(1, 0), Point(4, 0), Point(0, 0), Point(2, 0)});
+    CHECK(pair.getRadius() == doctest::Approx(2.));
+    CHECK(pair.getCenter().distance(Point(2, 0)) == doctest::Approx(0.));
+
+    // Determined by three points of an acute triangle, far from the origin.
+    auto triangle = computeMinimumEnclosingCircle({Point(1e6, 1e6), Point(1e6 + 2, 1e6), Point(1e6 + 1, 1e6 + 1.5), Point(1e6 + 1, 1e6 + .5)});
+    CHECK(triangle.getCenter().x() == doctest::Approx(1e6 + 1));
+    CHECK(triangle.getRadius() == doctest::Approx(std::sqrt(1. + 5. / 12. * 5. / 12.)));
+
+    CHECK_THROWS_AS(computeMinimumEnclosingCircle({}), std::invalid_argument);
+
+    std::mt19937 generator(49);
+    std::uniform_real_distribution<double> distribution(-10., 10.);
+    for (int i = 0; i < 50; ++i)
+    {
+        std::vector<Point> points;
+        for (int j = 0; j < 20; ++j)
+        {
+            points.emplace_back(distribution(generator), distribution(generator));
+        }
+        auto circle = computeMinimumEnclosingCircle(points);
+        CHECK(isEnclosing(circle, points));
+        CHECK(circle.getRadius() == doctest::Approx(computeRadiusByBruteForce(points)));
+    }
+
+    // Many points inside a unit disk, and the three points defining its boundary.
+    std::vector<Point> disk;
+    for (int i = 0; i < 200000; ++i)
+    {
+        Point point(distribution(generator) / 10., distribution(generator) / 10.);
+        if (point.squareNorm() < 1.) disk.push_back(point);
+    }
+    disk.emplace_back(1., 0.);
+    disk.emplace_back(-.5, std::sqrt(.75));
+    disk.emplace_back(-.5, -std::sqrt(.75));
+    auto diskCircle = computeMinimumEnclosingCircle(disk);
+    CHECK(diskCircle.getRadius() == doctest::Approx(1.));
+    CHECK(diskCircle.getCenter().norm() == doctest::Approx(0.).epsilon(1e-9));
+}
+
+TEST_CASE("computeMinimumEnclosingCircles")
+{
+    std::mt19937 generator(149);
+    std::uniform_real_distribution<double> distribution(-10., 10.);
+    std::uniform_int_distribution<int> sizeDistribution(1, 12);
+
+    std::vector<std::vector<Point>> pointSets;
+    for (int i = 0; i < 1000; ++i)
+    {
+        std::vector<Point> points;
+        int size = sizeDistribution(generator);
+        for (int j = 0; j < size; ++j)
+        {
+            points.emplace_back(distribution(generator), distribution(generator));
+        }
+        pointSets.push_back(points);
+    }
+
+    auto circles = computeMinimumEnclosingCircles(pointSets, 3);
+    REQUIRE(circles.size() == pointSets.size());
+    for (size_t i = 0; i < pointSets.size(); ++i)
+    {
+        auto circle = computeMinimumEnclosingCircle(pointSets[i]);
+        CHECK(circles[i].getRadius() == circle.getRadius());
+        CHECK(circles[i].getCenter().distance(circle.getCenter()) == 0.);
+    }
+
+    CHECK(computeMinimumEnclosingCircles({}).empty());
+}
@@ -6,26 +6,73 @@
 
 using namespace algorithms;
 
-TEST_CASE("IntersectionEvent constructor")
+TEST_CASE("Intersection event constructor")
 {
     primitives::LineSegment firstLine(primitives::Point(-1., 0.), primitives::Point(1., 0.));
     primitives::LineSegment secondLine(primitives::Point(-1., 1.), primitives::Point(1., 1.));
 
-    CHECK_THROWS(IntersectionEvent(firstLine, secondLine));
+    CHECK_THROWS(Event(firstLine, 0, secondLine, 1));
 }
 
-TEST_CASE("getType polymorphism")
+TEST_CASE("Event types and positions")
 {
     primitives::LineSegment firstLine(primitives::Point(-1., 0.), primitives::Point(1., 0.));
-    primitives::LineSegment secondLine(primitives::Point(0., 1.), primitives::Point(0., -1.));
-    IntersectionEvent intersection(firstLine, secondLine);
-    Event* eventPtrToIntersection = &intersection;
+    primitives::LineSegment secondLine(primitives::Point(0., -1.), primitives::Point(0., 1.));
+    Event intersection(firstLine, 0, secondLine, 1);
 
-    CHECK(eventPtrToIntersection->getType() == EventType::Intersection);
+    CHECK(intersection.getType() == EventType::Intersection);
+    CHECK(intersection.getPosition().squareDistance(primitives::Point(0., 0.)) < 1e-12);
+    CHECK(intersection.getFirstLineIdx() == 0);
+    CHECK(intersection.getSecondLineIdx() == 1);
+    CHECK(intersection.isSameIntersection(Event(secondLine, 1, firstLine, 0)));
 
-    EndPointEvent endPoint(firstLine, true);
+    Event upperEndPoint(secondLine, 1, true);
+    Event lowerEndPoint(secondLine, 1, false);
 
-    Event* eventPtrToEndPoint = &endPoint;
+    CHECK(upperEndPoint.getType() == EventType::EndPoint);
+    CHECK(upperEndPoint.getPosition().squareDistance(primitives::Point(0., 1.)) < 1e-12);
+    CHECK(lowerEndPoint.getPosition().squareDistance(primitives::Point(0., -1.)) < 1e-12);
+    CHECK(!upperEndPoint.isSameIntersection(intersection));
 
-    CHECK(eventPtrToEndPoint->getType() == EventType::EndPoint);
+    CHECK(upperEndPoint < intersection);
+    CHECK(intersection < lowerEndPoint);
+}
+
+TEST_CASE("EventQueue ordering")
+{
+    primitives::LineSegment firstLine(primitives::Point(-1., 1.), primitives::Point(1., -1.));
+    primitives::LineSegment secondLine(primitives::Point(-1., -1.), primitives::Point(1., 1.));
+    primitives::LineSegment thirdLine(primitives::Point(0., 0.), primitives::Point(2., -1.));
+
+    EventQueue queue;
+    queue.push(Event(thirdLine, 2, false));
+    queue.push(Event(thirdLine, 2, true));
+    queue.push(Event(firstLine, 0, false));
+    queue.push(Event(firstLine, 0, secondLine, 1));
+    queue.push(Event(secondLine, 1, true));
+    queue.push(Event(firstLine, 0, true));
+
+    CHECK(queue.size() == 6);
+    CHECK(queue.getSortedEvents().size() == 6);
+
+    // Upper end points at y = 1 from left to right, ...
+    CHECK(queue.top().getFirstLineIdx() == 0);
+    queue.pop();
+    CHECK(queue.top().getFirstLineIdx() == 1);
+    queue.pop();
+
+    // ... then the intersection before the upper end point at the same position, ...
+    CHECK(queue.top().getType() == EventType::Intersection);
+    queue.pop();
+    CHECK(queue.top().getFirstLineIdx() == 2);
+    CHECK(queue.top().isUpperEndPoint());
+    queue.pop();
+
+    // ... and lower end points at y = -1 last.
+    CHECK(!queue.top().isUpperEndPoint());
+    CHECK(queue.top().getFirstLineIdx() == 0);
+    queue.pop();
+    CHECK(queue.top().getFirstLineIdx() == 2);
+    queue.pop();
+    CHECK(queue.empty());
 }
@@ -110,3 +110,15 @@ TEST_CASE("Intersection in end points")
 
     CHECK(std::get<Point>(result).distance(Point(1., 0.)) < 1e-6);
 }
+
+TEST_CASE("Colinear line segments touching in an end point")
+{
+    LineSegment lineA(Point(0., 0.), Point(1., 1.));
+    LineSegment lineB(Point(2., 2.), Point(1., 1.));
+
+    auto result = lineA.computeIntersection(lineB);
+
+    REQUIRE(std::holds_alternative<Point>(result));
+    CHECK(std::get<Point>(result).distance(Point(1., 1.)) < 1e-6);
+    CHECK(std::holds_alternative<Point>(lineB.computeIntersection(lineA)));
+}
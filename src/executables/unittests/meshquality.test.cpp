@@ -0,0 +1,73 @@
+#include "executables/doctest.h"
+
+#include "algorithms/delaunay/meshquality.hpp"
+
+#include <cmath>
+#include <numeric>
+#include <random>
+
+using namespace algorithms;
+
+TEST_CASE("computeMeshQuality equilateral triangle")
+{
+    Triangulation triangulation{{primitives::Point(0, 0), primitives::Point(1, 0), primitives::Point(.5, std::sqrt(3.) / 2)}, {0, 1, 2}};
+
+    auto stats = computeMeshQuality(TriangulationTopology(triangulation));
+
+    CHECK(stats.numTriangles == 1);
+    CHECK(stats.minAngle == doctest::Approx(M_PI / 3));
+    CHECK(stats.maxAngle == doctest::Approx(M_PI / 3));
+    CHECK(stats.meanAspectRatio == doctest::Approx(1.));
+    CHECK(stats.meanRadiusEdgeRatio == doctest::Approx(1 / std::sqrt(3.)));
+    CHECK(stats.totalArea == doctest::Approx(std::sqrt(3.) / 4));
+    CHECK(stats.degreeHistogram == std::vector<size_t>{0, 0, 3});
+}
+
+TEST_CASE("computeMeshQuality square with center")
+{
+    Triangulation triangulation{{primitives::Point(0, 0), primitives::Point(2, 0), primitives::Point(2, 2),
+                                 primitives::Point(0, 2), primitives::Point(1, 1)},
+                                {0, 1, 4, 1, 2, 4, 2, 3, 4, 3, 0, 4}};
+
+    auto stats = computeMeshQuality(TriangulationTopology(triangulation), 4, 2);
+
+    CHECK(stats.numTriangles == 4);
+    CHECK(stats.minAngle == doctest::Approx(M_PI / 4));
+    CHECK(stats.maxAngle == doctest::Approx(M_PI / 2));
+    CHECK(stats.minAspectRatio == doctest::Approx(std::sqrt(3.)));
+    CHECK(stats.maxAspectRatio == doctest::Approx(std::sqrt(3.)));
+    CHECK(stats.maxRadiusEdgeRatio == doctest::Approx(1 / std::sqrt(2.)));
+    CHECK(stats.minArea == doctest::Approx(1.));
+    CHECK(stats.maxArea == doctest::Approx(1.));
+    CHECK(stats.areaHistogram == std::vector<size_t>{4, 0, 0, 0});
+    CHECK(stats.degreeHistogram == std::vector<size_t>{0, 0, 0, 4, 1});
+}
+
+TEST_CASE("computeMeshQuality is independent of number of threads")
+{
+    std::mt19937 gen(8642);
+    std::uniform_real_distribution<double> coordDist(-10, 10);
+    std::vector<primitives::Point> points;
+    for (int i = 0; i < 120; ++i)
+    {
+        points.push_back(primitives::Point(coordDist(gen), coordDist(gen)));
+    }
+    DelaunayTriangulator triangulator(points);
+    REQUIRE(triangulator.performTriangulation());
+    TriangulationTopology topology(triangulator.getTriangulation());
+
+    auto sequential = computeMeshQuality(topology, 8, 1);
+    auto parallel = computeMeshQuality(topology, 8, 5);
+
+    CHECK(sequential.minAngle == parallel.minAngle);
+    CHECK(sequential.maxAngle == parallel.maxAngle);
+    CHECK(sequential.maxAspectRatio == parallel.maxAspectRatio);
+    CHECK(sequential.meanRadiusEdgeRatio == doctest::Approx(parallel.meanRadiusEdgeRatio));
+    CHECK(sequential.areaHistogram == parallel.areaHistogram);
+    CHECK(sequential.degreeHistogram == parallel.degreeHistogram);
+
+    CHECK(std::accumulate(parallel.areaHistogram.begin(), parallel.areaHistogram.end(), size_t(0)) == parallel.numTriangles);
+    CHECK(std::accumulate(parallel.degreeHistogram.begin(), parallel.degreeHistogram.end(), size_t(0)) == points.size());
+    CHECK(parallel.minAngle > 0);
+    CHECK(parallel.maxAngle < M_PI);
+}
@@ -0,0 +1,149 @@
+#include "executables/doctest.h"
+
+#include "primitives/multipolygon.hpp"
+#include "primitives/polygonindex.hpp"
+
+#include <algorithm>
+
+using namespace primitives;
+
+namespace
+{
+
+// Two squares, the first one with a triangular hole touching its outer boundary in (2, 2) and a clockwise
+// square hole, the second one given clockwise.
+MultiPolygon getTestMultiPolygon()
+{
+    return MultiPolygon({Point(0, 0), Point(4, 0), Point(4, 4), Point(0, 4),
+                         Point(2, 2), Point(3, 1), Point(3, 3),
+                         Point(.5, .5), Point(.5, 1.5), Point(1.5, 1.5), Point(1.5, .5),
+                         Point(5, 0), Point(5, 1), Point(6, 1), Point(6, 0)},
+                        {0, 4, 7, 11, 15},
+                        {0, 3, 4});
+}
+
+} // namespace
+
+TEST_CASE("MultiPolygon - flat storage")
+{
+    auto multiPolygon = getTestMultiPolygon();
+
+    CHECK(multiPolygon.getNumPolygons() == 2);
+    CHECK(multiPolygon.getNumRings() == 4);
+    CHECK(multiPolygon.getNumVertices() == 15);
+    CHECK(multiPolygon.getNextVertex(3) == 0);
+    CHECK(multiPolygon.getNextVertex(4) == 5);
+    CHECK(multiPolygon.getEdges().size() == 15);
+
+    CHECK(multiPolygon.getPolygonArea(0) == doctest::Approx(16. - 1. - 1.));
+    CHECK(multiPolygon.getPolygonArea(1) == doctest::Approx(1.));
+    CHECK(multiPolygon.getArea() == doctest::Approx(15.));
+
+    // The holes are clockwise and the outer boundaries counterclockwise.
+    auto firstPolygon = multiPolygon.getPolygonWithHoles(0);
+    CHECK(firstPolygon.outer.getSignedArea() > 0.);
+    REQUIRE(firstPolygon.holes.size() == 2);
+    CHECK(firstPolygon.holes[0].getSignedArea() < 0.);
+    CHECK(firstPolygon.holes[1].getSignedArea() < 0.);
+    CHECK(multiPolygon.getPolygonWithHoles(1).outer.getSignedArea() > 0.);
+
+    MultiPolygon roundTrip({multiPolygon.getPolygonWithHoles(0), multiPolygon.getPolygonWithHoles(1)});
+    CHECK(roundTrip.getArea() == doctest::Approx(15.));
+    CHECK(roundTrip.getRingOffsets() == multiPolygon.getRingOffsets());
+}
+
+TEST_CASE("MultiPolygon::contains")
+{
+    auto multiPolygon = getTestMultiPolygon();
+    PolygonContainmentIndex index(multiPolygon);
+
+    std::vector<std::pair<Point, bool>> queries = {
+        {Point(3.5, 3.5), true},
+        {Point(2.8, 2), false},
+        {Point(1, 1), false},
+        {Point(2, 2), true},
+        {Point(1.5, 1), true},
+        {Point(5.5, .5), true},
+        {Point(4.5, .5), false},
+        {Point(-1, 2), false}};
+    for (const auto& [point, isContained] : queries)
+    {
+        CHECK(multiPolygon.contains(point) == isContained);
+        CHECK(index.contains(point) == isContained);
+    }
+
+    for (double x = -.5; x < 6.5; x += .1)
+    {
+        for (double y = -.5; y < 4.5; y += .1)
+        {
+            CHECK(index.contains(Point(x, y)) == multiPolygon.contains(Point(x, y)));
+        }
+    }
+}
+
+TEST_CASE("MultiPolygon - island in a lake")
+{
+    MultiPolygon multiPolygon({Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10),
+                               Point(2, 2), Point(8, 2), Point(8, 8), Point(2, 8),
+                               Point(4, 4), Point(6, 4), Point(6, 6), Point(4, 6)},
+                              {0, 4, 8, 12},
+                              {0, 2, 3});
+    PolygonContainmentIndex index(multiPolygon);
+
+    CHECK(multiPolygon.getArea() == doctest::Approx(100. - 36. + 4.));
+    for (const auto& [point, isContained] : std::vector<std::pair<Point, bool>>{{Point(1, 5), true}, {Point(3, 5), false}, {Point(5, 5), true}})
+    {
+        CHECK(multiPolygon.contains(point) == isContained);
+        CHECK(index.contains(point) == isContained);
+    }
+}
+
+TEST_CASE("MultiPolygon validation")
+{
+    CHECK_NOTHROW(MultiPolygon({}, {0}, {0}));
+    CHECK_THROWS_AS(MultiPolygon({Point(0, 0), Point(1, 0), Point(0, 1)}, {0, 2, 3}, {0, 2}), std::invalid_argument);
+    CHECK_THROWS_AS(MultiPolygon({Point(0, 0), Point(1, 0), Point(0, 1)}, {0, 3}, {0, 2}), std::invalid_argument);
+
+    // Rings of different polygons crossing each other.
+    CHECK_THROWS_AS(MultiPolygon({Point(0, 0), Point(2, 0), Point(2, 2), Point(0, 2),
+                                  Point(1, 1), Point(3, 1), Point(3, 3), Point(1, 3)},
+                                 {0, 4, 8}, {0, 1, 2}),
+                    std::logic_error);
+    // Hole outside of its outer boundary.
+    CHECK_THROWS_AS(MultiPolygon({Point(0, 0), Point(2, 0), Point(2, 2), Point(0, 2),
+                                  Point(3, 0), Point(4, 0), Point(4, 1)},
+                                 {0, 4, 7}, {0, 2}),
+                    std::logic_error);
+    // Hole inside another hole of the same polygon.
+    CHECK_THROWS_AS(MultiPolygon({Point(0, 0), Point(4, 0), Point(4, 4), Point(0, 4),
+                                  Point(1, 1), Point(3, 1), Point(3, 3), Point(1, 3),
+                                  Point(1.5, 1.5), Point(2.5, 1.5), Point(2.5, 2.5)},
+                                 {0, 4, 8, 11}, {0, 3}),
+                    std::logic_error);
+    // Polygon inside the interior of another polygon, given before and after it.
+    std::vector<Point> nested = {Point(0, 0), Point(4, 0), Point(4, 4), Point(0, 4),
+                                 Point(1, 1), Point(2, 1), Point(2, 2)};
+    CHECK_THROWS_AS(MultiPolygon(nested, {0, 4, 7}, {0, 1, 2}), std::logic_error);
+    std::rotate(nested.begin(), nested.begin() + 4, nested.end());
+    CHECK_THROWS_AS(MultiPolygon(nested, {0, 3, 7}, {0, 1, 2}), std::logic_error);
+    // Polygon inside the hole of another polygon, i. e., an island in a lake, is fine, and so is a polygon in
+    // a lake of that island. But not one inside the island itself.
+    CHECK_NOTHROW(MultiPolygon({Point(0, 0), Point(4, 0), Point(4, 4), Point(0, 4),
+                                Point(1, 1), Point(3, 1), Point(3, 3), Point(1, 3),
+                                Point(1.5, 1.5), Point(2.5, 1.5), Point(2.5, 2.5)},
+                               {0, 4, 8, 11}, {0, 2, 3}));
+    std::vector<Point> islands = {Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10),
+                                  Point(2, 2), Point(8, 2), Point(8, 8), Point(2, 8),
+                                  Point(3, 3), Point(7, 3), Point(7, 7), Point(3, 7),
+                                  Point(4, 4), Point(6, 4), Point(6, 6), Point(4, 6),
+                                  Point(4.5, 4.5), Point(5.5, 4.5), Point(5.5, 5.5)};
+    CHECK_NOTHROW(MultiPolygon(islands, {0, 4, 8, 12, 16, 19}, {0, 2, 4, 5}));
+    CHECK_THROWS_AS(MultiPolygon(islands, {0, 4, 8, 12, 16, 19}, {0, 2, 3, 5}), std::logic_error);
+
+    // Holes and polygons side by side, also touching in vertices, are fine.
+    CHECK_NOTHROW(MultiPolygon({Point(0, 0), Point(4, 0), Point(4, 4), Point(0, 4),
+                                Point(1, 1), Point(2, 1), Point(2, 2),
+                                Point(2, 2), Point(3, 2), Point(3, 3),
+                                Point(4, 4), Point(5, 4), Point(5, 5)},
+                               {0, 4, 7, 10, 13}, {0, 3, 4}));
+}
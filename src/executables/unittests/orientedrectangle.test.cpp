@@ -0,0 +1,39 @@
+#include "executables/doctest.h"
+
+#include "primitives/orientedrectangle.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+using namespace primitives;
+
+TEST_CASE("OrientedRectangle")
+{
+    // 4 x 2 rectangle around (1, 1), rotated by 45 degrees.
+    OrientedRectangle rectangle(Point(1, 1), Point(3, 3), 4., 2.);
+    CHECK(rectangle.getAxis().x() == doctest::Approx(std::sqrt(.5)));
+    CHECK(rectangle.getAxis().y() == doctest::Approx(std::sqrt(.5)));
+    CHECK(rectangle.getArea() == doctest::Approx(8.));
+    CHECK(rectangle.getPerimeter() == doctest::Approx(12.));
+
+    auto corners = rectangle.getCorners();
+    double doubleArea = 0.;
+    for (size_t i = 0; i < corners.size(); ++i)
+    {
+        const auto& corner = corners[i];
+        const auto& nextCorner = corners[(i + 1) % corners.size()];
+        doubleArea += corner.x() * nextCorner.y() - nextCorner.x() * corner.y();
+        CHECK(rectangle.contains(corner));
+    }
+    CHECK(doubleArea / 2. == doctest::Approx(8.));
+    CHECK(corners[0].x() == doctest::Approx(1. - std::sqrt(2.) + std::sqrt(.5)));
+    CHECK(corners[0].y() == doctest::Approx(1. - std::sqrt(2.) - std::sqrt(.5)));
+
+    CHECK(rectangle.contains(Point(1, 1)));
+    CHECK(rectangle.contains(Point(2, 2)));
+    CHECK(!rectangle.contains(Point(2, 0)));
+    CHECK(!rectangle.contains(Point(3, 3)));
+
+    CHECK_THROWS_AS(OrientedRectangle(Point(0, 0), Point(0, 0), 1., 1.), std::invalid_argument);
+    CHECK_THROWS_AS(OrientedRectangle(Point(0, 0), Point(1, 0), -1., 1.), std::invalid_argument);
+}
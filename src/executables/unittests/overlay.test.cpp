@@ -0,0 +1,69 @@
+#include "executables/doctest.h"
+
+#include "algorithms/planesweep/overlay.hpp"
+
+#include <map>
+
+using namespace algorithms;
+using primitives::Point;
+using primitives::Polygon;
+
+namespace
+{
+
+// Total area of the faces per pair of (first polygon, second polygon).
+std::map<std::pair<size_t, size_t>, double> getAreasByProvenance(const Overlay& overlay)
+{
+    std::map<std::pair<size_t, size_t>, double> areas;
+    for (size_t f = 1; f < overlay.arrangement.getNumFaces(); ++f)
+    {
+        areas[{overlay.firstFacePolygons[f], overlay.secondFacePolygons[f]}] += overlay.arrangement.getFaceArea(f);
+    }
+    return areas;
+}
+
+} // namespace
+
+TEST_CASE("computeOverlay - two zones and a parcel across them")
+{
+    std::vector<Polygon> zones = {
+        Polygon({Point(0., 0.), Point(2., 0.), Point(2., 2.), Point(0., 2.)}),
+        Polygon({Point(2., 0.), Point(4., 0.), Point(4., 2.), Point(2., 2.)})};
+    // Clockwise on purpose.
+    std::vector<Polygon> parcels = {
+        Polygon({Point(1., 1.), Point(1., 3.), Point(3., 3.), Point(3., 1.)})};
+
+    auto overlay = computeOverlay(zones, parcels);
+
+    REQUIRE(overlay.arrangement.getNumFaces() == 6);
+    CHECK(overlay.firstFacePolygons[0] == NoPolygon);
+    CHECK(overlay.secondFacePolygons[0] == NoPolygon);
+
+    auto areas = getAreasByProvenance(overlay);
+    CHECK(areas.size() == 5);
+    CHECK(areas[{0, 0}] == doctest::Approx(1.));
+    CHECK(areas[{1, 0}] == doctest::Approx(1.));
+    CHECK(areas[{0, NoPolygon}] == doctest::Approx(3.));
+    CHECK(areas[{1, NoPolygon}] == doctest::Approx(3.));
+    CHECK(areas[{NoPolygon, 0}] == doctest::Approx(2.));
+}
+
+TEST_CASE("computeOverlay - parcel strictly inside a zone")
+{
+    std::vector<Polygon> zones = {
+        Polygon({Point(0., 0.), Point(10., 0.), Point(10., 10.), Point(0., 10.)})};
+    std::vector<Polygon> parcels = {
+        Polygon({Point(2., 2.), Point(4., 2.1), Point(4., 4.), Point(2., 4.)}),
+        Polygon({Point(4., 2.1), Point(6., 2.), Point(6., 4.), Point(4., 4.)}),
+        Polygon({Point(20., 0.), Point(21., 0.), Point(21., 1.)})};
+
+    auto overlay = computeOverlay(zones, parcels, 2);
+
+    REQUIRE(overlay.arrangement.getNumFaces() == 5);
+    auto areas = getAreasByProvenance(overlay);
+    CHECK(areas.size() == 4);
+    CHECK(areas[{0, 0}] == doctest::Approx(2. * 2. - .1));
+    CHECK(areas[{0, 1}] == doctest::Approx(2. * 2. - .1));
+    CHECK(areas[{0, NoPolygon}] == doctest::Approx(100. - 8. + .2));
+    CHECK(areas[{NoPolygon, 2}] == doctest::Approx(.5));
+}
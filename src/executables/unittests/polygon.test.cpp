@@ -44,3 +44,21 @@ TEST_CASE("Polygon::contains chevron shape")
     CHECK(chevron.contains(pointInLeftTail));
     CHECK(chevron.contains(pointInRightTail));
 }
+
+TEST_CASE("Polygon constructor rejects self-intersecting polygons")
+{
+    CHECK_NOTHROW(Polygon({Point(0, 0), Point(2, 0), Point(2, 2), Point(1, .5), Point(0, 2)}));
+    CHECK_THROWS(Polygon({Point(0, 0), Point(2, 2), Point(2, 0), Point(0, 2)}));
+}
+
+TEST_CASE("Polygon::contains with ray through vertices")
+{
+    // The ray to the right of the queried points passes through both tips resp. along the top edge.
+    Polygon crown({Point(0, 0), Point(4, 0), Point(4, 2), Point(3, 1), Point(2, 2), Point(1, 1), Point(0, 2)});
+
+    CHECK(!crown.contains(Point(-1, 2)));
+    CHECK(!crown.contains(Point(-1, 0)));
+    CHECK(crown.contains(Point(.5, 1)));
+    CHECK(!crown.contains(Point(2.5, 2)));
+    CHECK(crown.contains(Point(2, 1)));
+}
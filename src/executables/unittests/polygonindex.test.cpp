@@ -0,0 +1,96 @@
+#include "executables/doctest.h"
+
+#include "primitives/polygonindex.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <random>
+
+using namespace primitives;
+
+namespace
+{
+
+// Star shaped polygon with <numVertices> vertices at random distances from the origin.
+Polygon getRandomStar(size_t numVertices, std::mt19937& rng)
+{
+    std::uniform_real_distribution<double> radiusDistribution(.2, 1.);
+    std::vector<Point> vertices;
+    for (size_t i = 0; i < numVertices; ++i)
+    {
+        double angle = 2. * M_PI * static_cast<double>(i) / static_cast<double>(numVertices);
+        double radius = radiusDistribution(rng);
+        vertices.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+    }
+    return Polygon(vertices);
+}
+
+} // namespace
+
+TEST_CASE("PolygonContainmentIndex matches Polygon::contains")
+{
+    Polygon chevron({Point(0, 0), Point(-1, 2), Point(0, 1), Point(1, 2)});
+    PolygonContainmentIndex chevronIndex(chevron);
+    CHECK(chevronIndex.contains(Point(0, .5)));
+    CHECK(!chevronIndex.contains(Point(0, 1.5)));
+    CHECK(!chevronIndex.contains(Point(-1, 1)));
+    CHECK(chevronIndex.contains(Point(.75, 1.5)));
+    CHECK(chevronIndex.contains(Point(-1, 2)));
+    CHECK(chevronIndex.contains(Point(.5, 1.5)));
+    CHECK(!chevronIndex.contains(Point(5, 5)));
+
+    std::mt19937 rng(42);
+    std::uniform_real_distribution<double> coordinateDistribution(-1.1, 1.1);
+    for (size_t numVertices : {3, 10, 200})
+    {
+        auto star = getRandomStar(numVertices, rng);
+        PolygonContainmentIndex index(star);
+
+        std::vector<Point> points;
+        for (size_t i = 0; i < 2000; ++i)
+        {
+            points.emplace_back(coordinateDistribution(rng), coordinateDistribution(rng));
+        }
+        for (size_t i = 0; i < star.size(); ++i)
+        {
+            auto edge = star.getEdge(i);
+            points.push_back(edge.getStartPoint());
+            points.emplace_back((edge.getStartPoint().x() + edge.getEndPoint().x()) / 2.,
+                                (edge.getStartPoint().y() + edge.getEndPoint().y()) / 2.);
+        }
+
+        auto batchResults = index.contains(points, 3);
+        REQUIRE(batchResults.size() == points.size());
+        for (size_t i = 0; i < points.size(); ++i)
+        {
+            bool isContained = star.contains(points[i]);
+            CHECK(index.contains(points[i]) == isContained);
+            CHECK(batchResults[i] == isContained);
+        }
+    }
+}
+
+TEST_CASE("PolygonContainmentIndex - clockwise comb")
+{
+    // Teeth pointing down, so that horizontal lines hit many vertices.
+    std::vector<Point> vertices = {Point(0, 10)};
+    for (int tooth = 0; tooth < 20; ++tooth)
+    {
+        vertices.emplace_back(2 * tooth, 0);
+        vertices.emplace_back(2 * tooth + 1, 5);
+    }
+    vertices.emplace_back(40, 10);
+    std::reverse(vertices.begin(), vertices.end());
+    Polygon comb(vertices);
+    PolygonContainmentIndex index(comb);
+
+    for (int x = -1; x <= 41; ++x)
+    {
+        for (int y = -1; y <= 11; ++y)
+        {
+            Point point(x + .25, y + .25);
+            CHECK(index.contains(point) == comb.contains(point));
+            CHECK(index.contains(Point(x, y)) == comb.contains(Point(x, y)));
+        }
+    }
+}
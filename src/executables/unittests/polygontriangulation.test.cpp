@@ -0,0 +1,111 @@
+#include "executables/doctest.h"
+
+#include "algorithms/planesweep/polygontriangulation.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace algorithms;
+using primitives::Point;
+using primitives::Polygon;
+using primitives::PolygonWithHoles;
+
+namespace
+{
+
+// Checks that all triangles are counterclockwise and returns their total area.
+double getTriangulatedArea(const Triangulation& triangulation)
+{
+    double area = 0.;
+    for (size_t i = 0; i < triangulation.indices.size(); i += 3)
+    {
+        const auto& p1 = triangulation.vertices[triangulation.indices[i]];
+        const auto& p2 = triangulation.vertices[triangulation.indices[i + 1]];
+        const auto& p3 = triangulation.vertices[triangulation.indices[i + 2]];
+        double triangleArea = ((p2.x() - p1.x()) * (p3.y() - p1.y()) - (p2.y() - p1.y()) * (p3.x() - p1.x())) / 2.;
+        CHECK(triangleArea > 0.);
+        area += triangleArea;
+    }
+    return area;
+}
+
+} // namespace
+
+TEST_CASE("triangulatePolygon - simple polygons")
+{
+    Polygon square({Point(0, 0), Point(1, 0), Point(1, 1), Point(0, 1)});
+    auto squareTriangulation = triangulatePolygon(square);
+    CHECK(squareTriangulation.vertices.size() == 4);
+    CHECK(squareTriangulation.indices.size() == 2 * 3);
+    CHECK(getTriangulatedArea(squareTriangulation) == doctest::Approx(1.));
+
+    // Clockwise, with split and merge vertices.
+    Polygon chevron({Point(0, 0), Point(-1, 2), Point(0, 1), Point(1, 2)});
+    auto chevronTriangulation = triangulatePolygon(chevron);
+    CHECK(chevronTriangulation.indices.size() == 2 * 3);
+    CHECK(getTriangulatedArea(chevronTriangulation) == doctest::Approx(std::abs(chevron.getSignedArea())));
+
+    // Teeth pointing both up and down, with horizontal edges between them.
+    std::vector<Point> vertices;
+    for (int tooth = 0; tooth < 10; ++tooth)
+    {
+        vertices.emplace_back(2 * tooth, 0);
+        vertices.emplace_back(2 * tooth + 1, 0);
+        vertices.emplace_back(2 * tooth + 1, tooth % 2 ? 3 : 4);
+    }
+    for (int tooth = 9; tooth >= 0; --tooth)
+    {
+        vertices.emplace_back(2 * tooth + 2, 6);
+        vertices.emplace_back(2 * tooth + 1, 6);
+        vertices.emplace_back(2 * tooth + 1, tooth % 2 ? 5 : 4.5);
+    }
+    Polygon combs(vertices);
+    auto combsTriangulation = triangulatePolygon(combs);
+    CHECK(combsTriangulation.indices.size() == (vertices.size() - 2) * 3);
+    CHECK(getTriangulatedArea(combsTriangulation) == doctest::Approx(combs.getSignedArea()));
+}
+
+TEST_CASE("triangulatePolygon - polygon with holes")
+{
+    PolygonWithHoles polygon{Polygon({Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10)}),
+                             {Polygon({Point(1, 1), Point(3, 1), Point(3, 3), Point(1, 3)}),
+                              Polygon({Point(5, 5), Point(8, 6), Point(6, 8)}),
+                              Polygon({Point(1, 5), Point(2, 9), Point(3, 5), Point(2, 6)})}};
+
+    auto triangulation = triangulatePolygon(polygon);
+    CHECK(triangulation.vertices.size() == 15);
+    CHECK(triangulation.indices.size() == (15 + 2 * 3 - 2) * 3);
+    double holeArea = 4. + std::abs(polygon.holes[1].getSignedArea()) + std::abs(polygon.holes[2].getSignedArea());
+    CHECK(getTriangulatedArea(triangulation) == doctest::Approx(100. - holeArea));
+}
+
+TEST_CASE("triangulatePolygon - rings which are not strictly simple")
+{
+    // Rings touching themselves in a vertex, which Polygon accepts.
+    CHECK_THROWS_AS(triangulatePolygon(Polygon({Point(0, 0), Point(4, 0), Point(2, 2), Point(4, 4), Point(0, 4), Point(2, 2)})),
+                    std::invalid_argument);
+    CHECK_THROWS_AS(triangulatePolygon(Polygon({Point(0, 0), Point(2, 2), Point(4, 0), Point(4, 4), Point(2, 2), Point(0, 4)})),
+                    std::invalid_argument);
+
+    // Hole touching the outer boundary.
+    Polygon square({Point(0, 0), Point(10, 0), Point(10, 10), Point(0, 10)});
+    CHECK_THROWS_AS(triangulatePolygon(PolygonWithHoles{square, {Polygon({Point(0, 0), Point(3, 1), Point(1, 3)})}}),
+                    std::invalid_argument);
+}
+
+TEST_CASE("triangulatePolygon - large star")
+{
+    std::vector<Point> vertices;
+    size_t numVertices = 2000;
+    for (size_t i = 0; i < numVertices; ++i)
+    {
+        double angle = 2. * M_PI * static_cast<double>(i) / static_cast<double>(numVertices);
+        double radius = i % 2 ? .5 : 1. + .1 * std::sin(7. * angle);
+        vertices.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+    }
+    Polygon star(vertices);
+
+    auto triangulation = triangulatePolygon(star);
+    CHECK(triangulation.indices.size() == (numVertices - 2) * 3);
+    CHECK(getTriangulatedArea(triangulation) == doctest::Approx(star.getSignedArea()));
+}
@@ -0,0 +1,239 @@
+#include "executables/doctest.h"
+
+#include "algorithms/delaunay/powerdiagram.hpp"
+#include "algorithms/delaunay/triangulation.hpp"
+
+#include <algorithm>
+#include <random>
+
+using namespace algorithms;
+
+namespace
+{
+
+bool hasEdge(const DelaunayTriangulator& triangulator, size_t v1, size_t v2)
+{
+    auto [startIt, endIt] = triangulator.getEdges().equal_range(v1);
+    return std::find_if(startIt, endIt, [v2](const std::pair<size_t, size_t>& edge) { return edge.second == v2; }) != endIt;
+}
+
+double getCellArea(const PowerDiagram& diagram, size_t cell)
+{
+    double area = 0;
+    for (size_t i = diagram.cellOffsets[cell]; i < diagram.cellOffsets[cell + 1]; ++i)
+    {
+        size_t next = i + 1 < diagram.cellOffsets[cell + 1] ? i + 1 : diagram.cellOffsets[cell];
+        const auto& p = diagram.vertices[diagram.cellIndices[i]];
+        const auto& q = diagram.vertices[diagram.cellIndices[next]];
+        area += p.x() * q.y() - q.x() * p.y();
+    }
+    return .5 * area;
+}
+
+double getTriangulationArea(const Triangulation& triangulation)
+{
+    double area = 0;
+    for (size_t t = 0; t < triangulation.indices.size(); t += 3)
+    {
+        const auto& a = triangulation.vertices[triangulation.indices[t]];
+        const auto& b = triangulation.vertices[triangulation.indices[t + 1]];
+        const auto& c = triangulation.vertices[triangulation.indices[t + 2]];
+        area += .5 * ((b.x() - a.x()) * (c.y() - a.y()) - (b.y() - a.y()) * (c.x() - a.x()));
+    }
+    return area;
+}
+
+} // namespace
+
+TEST_CASE("DelaunayTriangulator weighted constructor")
+{
+    std::vector<primitives::Point> points{primitives::Point(1.3, 1.7), primitives::Point(2.3, 1.7), primitives::Point(1.3, 2.7)};
+
+    CHECK_THROWS(DelaunayTriangulator(points, {0., 1.}));
+    CHECK(DelaunayTriangulator(points, {0., 1., 2.}).isWeighted());
+    CHECK(!DelaunayTriangulator(points).isWeighted());
+}
+
+TEST_CASE("DelaunayTriangulator power test flips towards heavier vertex")
+{
+    std::vector<primitives::Point> square{primitives::Point(1.3, 1.7), primitives::Point(2.3, 1.7),
+                                          primitives::Point(2.3, 2.7), primitives::Point(1.3, 2.71)};
+
+    DelaunayTriangulator lightCorner(square, {0., .2, 0., .2});
+    DelaunayTriangulator heavyCorner(square, {.2, 0., .2, 0.});
+
+    CHECK(lightCorner.performTriangulation());
+    CHECK(heavyCorner.performTriangulation());
+
+    CHECK(lightCorner.isDelaunay());
+    CHECK(heavyCorner.isDelaunay());
+
+    CHECK(hasEdge(lightCorner, 1, 3));
+    CHECK(!hasEdge(lightCorner, 0, 2));
+    CHECK(hasEdge(heavyCorner, 0, 2));
+    CHECK(!hasEdge(heavyCorner, 1, 3));
+}
+
+TEST_CASE("DelaunayTriangulator zero weights give Delaunay triangulation")
+{
+    std::mt19937 gen(1234);
+    std::uniform_real_distribution<double> coordDist(-10, 10);
+
+    std::vector<primitives::Point> points;
+    for (int i = 0; i < 40; ++i)
+    {
+        points.push_back(primitives::Point(coordDist(gen), coordDist(gen)));
+    }
+
+    DelaunayTriangulator unweighted(points);
+    DelaunayTriangulator weighted(points, std::vector<double>(points.size(), 0.));
+
+    REQUIRE(unweighted.performTriangulation());
+    REQUIRE(weighted.performTriangulation());
+
+    CHECK(weighted.getWeights().size() == points.size());
+    CHECK(weighted.getTriangulation().indices.size() == unweighted.getTriangulation().indices.size());
+    for (const auto& [v1, v2] : unweighted.getEdges())
+    {
+        CHECK(hasEdge(weighted, v1, v2));
+    }
+}
+
+TEST_CASE("DelaunayTriangulator::getTriangulation")
+{
+    DelaunayTriangulator triangulator(std::vector<primitives::Point>{primitives::Point(1.3, 1.7), primitives::Point(3.3, 1.7),
+                                                                     primitives::Point(3.3, 3.7), primitives::Point(1.3, 3.7),
+                                                                     primitives::Point(2.2, 2.9)});
+    REQUIRE(triangulator.performTriangulation());
+
+    auto triangulation = triangulator.getTriangulation();
+
+    CHECK(triangulation.vertices.size() == 5);
+    CHECK(triangulation.indices.size() == 4 * 3);
+    for (size_t t = 0; t < triangulation.indices.size(); t += 3)
+    {
+        const auto& a = triangulation.vertices[triangulation.indices[t]];
+        const auto& b = triangulation.vertices[triangulation.indices[t + 1]];
+        const auto& c = triangulation.vertices[triangulation.indices[t + 2]];
+        CHECK((b.x() - a.x()) * (c.y() - a.y()) - (b.y() - a.y()) * (c.x() - a.x()) > 0);
+    }
+}
+
+TEST_CASE("computePowerDiagram")
+{
+    std::vector<primitives::Point> points{primitives::Point(1.3, 1.7), primitives::Point(3.3, 1.7),
+                                          primitives::Point(3.3, 3.7), primitives::Point(1.3, 3.7),
+                                          primitives::Point(2.2, 2.9)};
+
+    DelaunayTriangulator unweighted(points);
+    DelaunayTriangulator weighted(points, {0., 0., 0., 0., .5});
+    REQUIRE(unweighted.performTriangulation());
+    REQUIRE(weighted.performTriangulation());
+
+    auto voronoi = computePowerDiagram(unweighted);
+    auto power = computePowerDiagram(weighted);
+
+    REQUIRE(power.cellOffsets.size() == points.size() + 1);
+    for (size_t corner = 0; corner < 4; ++corner)
+    {
+        CHECK(!power.isCellBounded[corner]);
+    }
+    CHECK(power.isCellBounded[4]);
+    CHECK(power.cellOffsets[5] - power.cellOffsets[4] == 4);
+
+    // Cells are listed counter-clockwise, and a heavier site gets a larger cell.
+    CHECK(getCellArea(voronoi, 4) > 0);
+    CHECK(getCellArea(power, 4) > getCellArea(voronoi, 4));
+
+    // Every diagram vertex has equal power distance to the sites of its triangle.
+    auto triangulation = weighted.getTriangulation();
+    for (size_t t = 0; t < power.vertices.size(); ++t)
+    {
+        auto powerDistance = [&](size_t corner)
+        {
+            size_t v = triangulation.indices[3 * t + corner];
+            return power.vertices[t].squareDistance(points[v]) - weighted.getWeights()[v];
+        };
+        CHECK(powerDistance(0) == doctest::Approx(powerDistance(1)));
+        CHECK(powerDistance(0) == doctest::Approx(powerDistance(2)));
+    }
+}
+
+TEST_CASE("computePowerDiagram with redundant site")
+{
+    std::vector<primitives::Point> points{primitives::Point(0, 0), primitives::Point(10, 0),
+                                          primitives::Point(5, 9), primitives::Point(5, 3)};
+
+    // The light site is redundant whether it is inserted before or after the heavy ones.
+    for (bool isLightSiteFirst : {false, true})
+    {
+        std::vector<double> weights{100., 100., 100., 0.};
+        size_t lightSite = 3;
+        if (isLightSiteFirst)
+        {
+            std::swap(points[0], points[3]);
+            std::swap(weights[0], weights[3]);
+            lightSite = 0;
+        }
+
+        DelaunayTriangulator triangulator(points, weights);
+        REQUIRE(triangulator.performTriangulation());
+        CHECK(triangulator.isDelaunay());
+        CHECK(triangulator.getEdges().count(lightSite) == 0);
+        CHECK(triangulator.getTriangulation().indices.size() == 3);
+
+        auto diagram = computePowerDiagram(triangulator);
+        REQUIRE(diagram.cellOffsets.size() == points.size() + 1);
+        CHECK(diagram.vertices.size() == 1);
+        for (size_t site = 0; site < points.size(); ++site)
+        {
+            size_t cellSize = diagram.cellOffsets[site + 1] - diagram.cellOffsets[site];
+            if (site == lightSite)
+            {
+                CHECK(cellSize == 0);
+                CHECK(diagram.isCellBounded[site]);
+            }
+            else
+            {
+                CHECK(cellSize == 1);
+                CHECK(!diagram.isCellBounded[site]);
+            }
+        }
+    }
+}
+
+TEST_CASE("DelaunayTriangulator removes redundant vertices")
+{
+    std::mt19937 gen(4321);
+    std::uniform_real_distribution<double> coordDist(-10, 10);
+    std::uniform_real_distribution<double> weightDist(0, 20);
+
+    std::vector<primitives::Point> points;
+    std::vector<double> weights;
+    for (int i = 0; i < 200; ++i)
+    {
+        points.push_back(primitives::Point(coordDist(gen), coordDist(gen)));
+        weights.push_back(weightDist(gen));
+    }
+
+    DelaunayTriangulator unweighted(points);
+    DelaunayTriangulator weighted(points, weights);
+    REQUIRE(unweighted.performTriangulation());
+    REQUIRE(weighted.performTriangulation());
+    CHECK(weighted.isDelaunay());
+
+    // Convex hull vertices are never redundant, so both triangulations cover the same area.
+    auto triangulation = weighted.getTriangulation();
+    CHECK(getTriangulationArea(triangulation) == doctest::Approx(getTriangulationArea(unweighted.getTriangulation())));
+
+    size_t numRedundant = 0;
+    auto diagram = computePowerDiagram(weighted);
+    for (size_t v = 0; v < points.size(); ++v)
+    {
+        bool isRedundant = weighted.getEdges().count(v) == 0;
+        numRedundant += isRedundant;
+        CHECK((diagram.cellOffsets[v + 1] == diagram.cellOffsets[v]) == isRedundant);
+    }
+    CHECK(numRedundant > 0);
+    CHECK(triangulation.indices.size() / 3 < unweighted.getTriangulation().indices.size() / 3);
+}
@@ -0,0 +1,150 @@
+#include "executables/doctest.h"
+
+#include "algorithms/clipping/rectclip.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+using namespace algorithms;
+using primitives::LineSegment;
+using primitives::Point;
+using primitives::Polygon;
+
+namespace
+{
+
+double getSignedArea(const CoordinateArrays& ring)
+{
+    double doubleArea = 0.;
+    for (size_t i = 0; i < ring.size(); ++i)
+    {
+        size_t next = (i + 1) % ring.size();
+        doubleArea += ring.xs[i] * ring.ys[next] - ring.xs[next] * ring.ys[i];
+    }
+    return doubleArea / 2.;
+}
+
+} // namespace
+
+TEST_CASE("clipLineSegments")
+{
+    ClipRectangle rectangle{0., 0., 2., 1.};
+    LineSegmentArrays lineSegments;
+    auto add = [&lineSegments](double startX, double startY, double endX, double endY)
+    {
+        lineSegments.startXs.push_back(startX);
+        lineSegments.startYs.push_back(startY);
+        lineSegments.endXs.push_back(endX);
+        lineSegments.endYs.push_back(endY);
+    };
+    add(-1., .5, 3., .5);   // Horizontal through.
+    add(1., -1., 1., 2.);   // Vertical through.
+    add(.5, .25, 1.5, .75); // Inside.
+    add(-1., -1., 3., 1.);  // Diagonal, entering through the bottom.
+    add(3., 0., 3., 1.);    // Vertical outside.
+    add(-1., 2., 3., 2.);   // Horizontal outside.
+    add(-1., 1., 0., 2.);   // Diagonal outside, pointing at the corner.
+
+    LineSegmentArrays clipped;
+    std::vector<uint8_t> isVisible;
+    clipLineSegments(lineSegments, rectangle, clipped, isVisible);
+
+    REQUIRE(isVisible.size() == 7);
+    CHECK(isVisible == std::vector<uint8_t>{1, 1, 1, 1, 0, 0, 0});
+    CHECK(clipped.startXs[0] == doctest::Approx(0.));
+    CHECK(clipped.endXs[0] == doctest::Approx(2.));
+    CHECK(clipped.startYs[1] == doctest::Approx(0.));
+    CHECK(clipped.endYs[1] == doctest::Approx(1.));
+    CHECK(clipped.startXs[2] == doctest::Approx(.5));
+    CHECK(clipped.endYs[2] == doctest::Approx(.75));
+    CHECK(clipped.startXs[3] == doctest::Approx(1.));
+    CHECK(clipped.startYs[3] == doctest::Approx(0.));
+    CHECK(clipped.endXs[3] == doctest::Approx(2.));
+    CHECK(clipped.endYs[3] == doctest::Approx(.5));
+
+    auto single = clipLineSegment(LineSegment(Point(-1., -1.), Point(3., 1.)), rectangle);
+    REQUIRE(single);
+    CHECK(single->getStartPoint().x() == doctest::Approx(1.));
+    CHECK(single->getEndPoint().y() == doctest::Approx(.5));
+    CHECK(!clipLineSegment(LineSegment(Point(-1., 1.), Point(0., 2.)), rectangle));
+}
+
+TEST_CASE("clipRing")
+{
+    Polygon diamond({Point(0., -2.), Point(2., 0.), Point(0., 2.), Point(-2., 0.)});
+    auto clipped = clipRing(diamond, ClipRectangle{-1.5, -1.5, 1.5, 1.5});
+    CHECK(clipped.size() == 8);
+    CHECK(getSignedArea(clipped) == doctest::Approx(9. - 4. * .5));
+
+    auto corner = clipRing(diamond, ClipRectangle{0., 0., 3., 3.});
+    CHECK(corner.size() == 3);
+    CHECK(getSignedArea(corner) == doctest::Approx(2.));
+
+    CHECK(clipRing(diamond, ClipRectangle{2., 2., 3., 3.}).size() == 0);
+
+    // Clockwise rings stay clockwise.
+    Polygon clockwise({Point(0., 0.), Point(0., 4.), Point(4., 4.), Point(4., 0.)});
+    CHECK(getSignedArea(clipRing(clockwise, ClipRectangle{1., 1., 2., 5.})) == doctest::Approx(-3.));
+}
+
+TEST_CASE("clipRingToTiles agrees with clipRing per tile")
+{
+    std::vector<Point> vertices;
+    size_t numVertices = 60;
+    for (size_t i = 0; i < numVertices; ++i)
+    {
+        double angle = 2. * M_PI * static_cast<double>(i) / static_cast<double>(numVertices);
+        double radius = i % 2 ? 2. : 4. + std::sin(3. * angle);
+        vertices.emplace_back(radius * std::cos(angle), radius * std::sin(angle));
+    }
+    Polygon star(vertices);
+
+    // The grid doesn't cover all of the star, and has a tile boundary through the vertex (2, 0).
+    TileGrid grid{-4., -4., 1., 8, 7};
+    auto tiles = clipRingToTiles(star, grid);
+
+    double totalArea = 0.;
+    size_t numNonEmptyTiles = 0;
+    for (size_t tileX = 0; tileX < grid.numTilesX; ++tileX)
+    {
+        for (size_t tileY = 0; tileY < grid.numTilesY; ++tileY)
+        {
+            ClipRectangle rectangle{grid.originX + tileX * grid.tileSize, grid.originY + tileY * grid.tileSize,
+                                    grid.originX + (tileX + 1) * grid.tileSize, grid.originY + (tileY + 1) * grid.tileSize};
+            auto expected = clipRing(star, rectangle);
+            auto tile = std::find_if(tiles.begin(), tiles.end(),
+                                     [&](const ClippedTile& tile) { return tile.tileX == tileX && tile.tileY == tileY; });
+            if (expected.size() == 0)
+            {
+                CHECK(tile == tiles.end());
+                continue;
+            }
+
+            ++numNonEmptyTiles;
+            REQUIRE(tile != tiles.end());
+            CHECK(getSignedArea(tile->ring) == doctest::Approx(getSignedArea(expected)));
+            totalArea += getSignedArea(tile->ring);
+        }
+    }
+    CHECK(tiles.size() == numNonEmptyTiles);
+    CHECK(totalArea == doctest::Approx(getSignedArea(clipRing(star, ClipRectangle{-4., -4., 4., 3.}))));
+}
+
+TEST_CASE("clipRingToTiles only visits the tiles of the ring")
+{
+    // A ring across the corner of four tiles, far inside a grid of a trillion tiles.
+    TileGrid grid{0., 0., 1., 1000000, 1000000};
+    Polygon diamond({Point(123456., 654320.5), Point(123456.5, 654321.), Point(123456., 654321.5), Point(123455.5, 654321.)});
+    auto tiles = clipRingToTiles(diamond, grid);
+
+    REQUIRE(tiles.size() == 4);
+    for (const auto& tile : tiles)
+    {
+        CHECK((tile.tileX == 123455 || tile.tileX == 123456));
+        CHECK((tile.tileY == 654320 || tile.tileY == 654321));
+        CHECK(getSignedArea(tile.ring) == doctest::Approx(.125));
+    }
+
+    // Outside of the grid.
+    CHECK(clipRingToTiles(diamond, TileGrid{0., 0., 1., 1000, 1000}).empty());
+}
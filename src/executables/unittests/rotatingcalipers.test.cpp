@@ -0,0 +1,137 @@
+#include "executables/doctest.h"
+
+#include "algorithms/hull/convexhull.hpp"
+#include "algorithms/hull/rotatingcalipers.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <random>
+#include <stdexcept>
+
+using namespace algorithms;
+using primitives::Point;
+
+namespace
+{
+
+// Smallest area and perimeter over the enclosing rectangles with a side along some edge, and the smallest
+// height over the edges, in quadratic time.
+void computeByBruteForce(const std::vector<Point>& hull, double& minAreaOut, double& minPerimeterOut, double& minWidthOut)
+{
+    minAreaOut = minPerimeterOut = minWidthOut = std::numeric_limits<double>::infinity();
+    for (size_t e = 0; e < hull.size(); ++e)
+    {
+        const auto& origin = hull[e];
+        const auto& end = hull[(e + 1) % hull.size()];
+        double length = origin.distance(end);
+        double axisX = (end.x() - origin.x()) / length;
+        double axisY = (end.y() - origin.y()) / length;
+        double minAlong = 0., maxAlong = 0., maxAcross = 0.;
+        for (const auto& vertex : hull)
+        {
+            double along = (vertex.x() - origin.x()) * axisX + (vertex.y() - origin.y()) * axisY;
+            double across = (vertex.y() - origin.y()) * axisX - (vertex.x() - origin.x()) * axisY;
+            minAlong = std::min(minAlong, along);
+            maxAlong = std::max(maxAlong, along);
+            maxAcross = std::max(maxAcross, across);
+        }
+        minAreaOut = std::min(minAreaOut, (maxAlong - minAlong) * maxAcross);
+        minPerimeterOut = std::min(minPerimeterOut, 2. * (maxAlong - minAlong + maxAcross));
+        minWidthOut = std::min(minWidthOut, maxAcross);
+    }
+}
+
+double computeDiameterByBruteForce(const std::vector<Point>& hull)
+{
+    double maxSquareDistance = 0.;
+    for (const auto& first : hull)
+    {
+        for (const auto& second : hull)
+        {
+            maxSquareDistance = std::max(maxSquareDistance, first.squareDistance(second));
+        }
+    }
+    return std::sqrt(maxSquareDistance);
+}
+
+} // namespace
+
+TEST_CASE("Rotating calipers - rectangle")
+{
+    std::vector<Point> hull = {Point(0, 0), Point(4, 0), Point(4, 3), Point(0, 3)};
+    auto measures = computeCaliperMeasures(hull);
+    CHECK(measures.diameter.first.distance(measures.diameter.second) == doctest::Approx(5.));
+    CHECK(measures.width == doctest::Approx(3.));
+    CHECK(measures.minimumAreaRectangle.getArea() == doctest::Approx(12.));
+    CHECK(measures.minimumAreaRectangle.getCenter().distance(Point(2, 1.5)) == doctest::Approx(0.).epsilon(1e-12));
+    CHECK(measures.minimumPerimeterRectangle.getPerimeter() == doctest::Approx(14.));
+
+    // A diamond fits into a rotated rectangle smaller than its axis-parallel bounding box of area 8.
+    std::vector<Point> diamond = {Point(0, -1), Point(2, 0), Point(0, 1), Point(-2, 0)};
+    auto rectangle = computeMinimumAreaRectangle(diamond);
+    CHECK(rectangle.getArea() == doctest::Approx(6.4));
+    CHECK(std::abs(rectangle.getAxis().y()) > 0.);
+    CHECK(computeWidth(diamond) == doctest::Approx(4. / std::sqrt(5.)));
+    auto diameter = computeDiameter(diamond);
+    CHECK(diameter.first.distance(diameter.second) == doctest::Approx(4.));
+}
+
+TEST_CASE("Rotating calipers - degenerate hulls")
+{
+    auto point = computeCaliperMeasures({Point(1, 2)});
+    CHECK(point.width == 0.);
+    CHECK(point.minimumAreaRectangle.getArea() == 0.);
+    CHECK(point.minimumAreaRectangle.contains(Point(1, 2)));
+
+    auto segment = computeCaliperMeasures({Point(0, 0), Point(3, 4)});
+    CHECK(segment.diameter.first.distance(segment.diameter.second) == doctest::Approx(5.));
+    CHECK(segment.width == 0.);
+    CHECK(segment.minimumPerimeterRectangle.getWidth() == doctest::Approx(5.));
+    CHECK(segment.minimumPerimeterRectangle.getHeight() == 0.);
+    CHECK(segment.minimumPerimeterRectangle.contains(Point(1.5, 2)));
+
+    CHECK_THROWS_AS(computeCaliperMeasures(std::vector<Point>()), std::invalid_argument);
+}
+
+TEST_CASE("Rotating calipers - random hulls")
+{
+    std::mt19937 generator(48);
+    std::uniform_real_distribution<double> distribution(-10., 10.);
+    std::uniform_int_distribution<int> sizeDistribution(3, 200);
+
+    std::vector<std::vector<Point>> hulls;
+    for (int i = 0; i < 200; ++i)
+    {
+        std::vector<Point> points;
+        int numPoints = sizeDistribution(generator);
+        // Stretched and rotated, so that the rectangles are not axis-parallel.
+        double angle = distribution(generator);
+        for (int j = 0; j < numPoints; ++j)
+        {
+            double x = 3. * distribution(generator);
+            double y = distribution(generator);
+            points.emplace_back(x * std::cos(angle) - y * std::sin(angle), x * std::sin(angle) + y * std::cos(angle));
+        }
+        hulls.push_back(computeConvexHull(points));
+    }
+
+    auto measures = computeCaliperMeasures(hulls, 3);
+    REQUIRE(measures.size() == hulls.size());
+    for (size_t i = 0; i < hulls.size(); ++i)
+    {
+        const auto& hull = hulls[i];
+        double minArea, minPerimeter, minWidth;
+        computeByBruteForce(hull, minArea, minPerimeter, minWidth);
+        CHECK(measures[i].minimumAreaRectangle.getArea() == doctest::Approx(minArea));
+        CHECK(measures[i].minimumPerimeterRectangle.getPerimeter() == doctest::Approx(minPerimeter));
+        CHECK(measures[i].width == doctest::Approx(minWidth));
+        CHECK(measures[i].diameter.first.distance(measures[i].diameter.second) == doctest::Approx(computeDiameterByBruteForce(hull)));
+
+        bool isEnclosed = std::all_of(hull.begin(), hull.end(), [&](const Point& vertex)
+        {
+            return measures[i].minimumAreaRectangle.contains(vertex) && measures[i].minimumPerimeterRectangle.contains(vertex);
+        });
+        CHECK(isEnclosed);
+    }
+}
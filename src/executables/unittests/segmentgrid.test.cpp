@@ -0,0 +1,145 @@
+#include "executables/doctest.h"
+
+#include "algorithms/planesweep/segmentgrid.hpp"
+
+#include <cmath>
+#include <set>
+
+using namespace algorithms;
+using primitives::LineSegment;
+using primitives::Point;
+
+namespace
+{
+
+// Short line segments scattered over [0, 100]^2 by a fixed sequence, so that the test does not
+// depend on the standard library's random distributions.
+std::vector<LineSegment> getScatteredSegments(size_t numSegments, double length)
+{
+    std::vector<LineSegment> lines;
+    for (size_t i = 0; i < numSegments; ++i)
+    {
+        double x = std::fmod(i * 37.1234567, 100.);
+        double y = std::fmod(i * 61.7654321 + std::sqrt(static_cast<double>(i)), 100.);
+        double angle = i * 2.399963;
+        lines.push_back(LineSegment(Point(x, y), Point(x + length * std::cos(angle), y + length * std::sin(angle))));
+    }
+    return lines;
+}
+
+std::set<std::pair<size_t, size_t>> getIntersectingPairs(const std::vector<LineSegment>& lines)
+{
+    std::set<std::pair<size_t, size_t>> pairs;
+    for (size_t i = 0; i < lines.size(); ++i)
+    {
+        for (size_t j = i + 1; j < lines.size(); ++j)
+        {
+            if (lines[i].intersects(lines[j])) pairs.insert({i, j});
+        }
+    }
+    return pairs;
+}
+
+} // namespace
+
+TEST_CASE("SegmentGrid::perform agrees with brute force")
+{
+    auto lines = getScatteredSegments(600, 8.);
+    auto expected = getIntersectingPairs(lines);
+    REQUIRE(expected.size() > 20);
+
+    SegmentGrid grid(lines);
+    for (size_t numThreads : {1, 4})
+    {
+        std::vector<SegmentIntersection> intersections;
+        grid.perform(intersections, numThreads);
+
+        std::set<std::pair<size_t, size_t>> found;
+        for (size_t i = 0; i < intersections.size(); ++i)
+        {
+            CHECK(intersections[i].firstSegment < intersections[i].secondSegment);
+            CHECK(std::holds_alternative<Point>(intersections[i].intersection));
+            if (i > 0)
+            {
+                CHECK(std::make_pair(intersections[i - 1].firstSegment, intersections[i - 1].secondSegment)
+                      < std::make_pair(intersections[i].firstSegment, intersections[i].secondSegment));
+            }
+            found.insert({intersections[i].firstSegment, intersections[i].secondSegment});
+        }
+        CHECK(found == expected);
+    }
+}
+
+TEST_CASE("SegmentGrid::perform - segments spanning many cells")
+{
+    // A few long segments across many short ones; pairs sharing several cells must be reported once.
+    auto lines = getScatteredSegments(300, 2.);
+    lines.push_back(LineSegment(Point(-1., 3.), Point(101., 97.)));
+    lines.push_back(LineSegment(Point(2., 101.), Point(98., -1.)));
+    lines.push_back(LineSegment(Point(-1., 50.3), Point(101., 49.7)));
+
+    std::vector<SegmentIntersection> intersections;
+    SegmentGrid(lines).perform(intersections);
+
+    std::set<std::pair<size_t, size_t>> found;
+    for (const auto& intersection : intersections)
+    {
+        found.insert({intersection.firstSegment, intersection.secondSegment});
+    }
+    CHECK(found.size() == intersections.size());
+    CHECK(found == getIntersectingPairs(lines));
+}
+
+TEST_CASE("selectIntersectionStrategy")
+{
+    auto shortSegments = getScatteredSegments(2000, 1.);
+    auto statistics = computeSegmentStatistics(shortSegments);
+    CHECK(statistics.numLines == 2000);
+    CHECK(statistics.meanExtent < 1.);
+    CHECK(statistics.orientationSpread > .9);
+    CHECK(selectIntersectionStrategy(statistics) == IntersectionStrategy::UniformGrid);
+
+    // Long, almost parallel strokes: every grid cell holds most of them, but they hardly intersect.
+    std::vector<LineSegment> strokes;
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        double y = i * .05;
+        strokes.push_back(LineSegment(Point(std::fmod(i * .37, 3.), y), Point(97. + std::fmod(i * .61, 3.), y + .01)));
+    }
+    statistics = computeSegmentStatistics(strokes);
+    CHECK(statistics.orientationSpread < 1e-3);
+    CHECK(selectIntersectionStrategy(statistics) == IntersectionStrategy::Planesweep);
+
+    std::vector<SegmentIntersection> intersections;
+    computeIntersections(shortSegments, intersections);
+    std::set<std::pair<size_t, size_t>> found;
+    for (const auto& intersection : intersections)
+    {
+        found.insert({intersection.firstSegment, intersection.secondSegment});
+    }
+    CHECK(found == getIntersectingPairs(shortSegments));
+}
+
+TEST_CASE("computeIntersections - overlapping segments on the sweep path")
+{
+    std::vector<LineSegment> strokes;
+    for (size_t i = 0; i < 2000; ++i)
+    {
+        double y = i * .05;
+        strokes.push_back(LineSegment(Point(std::fmod(i * .37, 3.), y), Point(97. + std::fmod(i * .61, 3.), y + .01)));
+    }
+    // A collinear pair overlapping for 40 <= x <= 60, above all strokes. The sweep can't order the two.
+    strokes.push_back(LineSegment(Point(20., 200.5), Point(60., 200.51)));
+    strokes.push_back(LineSegment(Point(40., 200.505), Point(80., 200.515)));
+    REQUIRE(selectIntersectionStrategy(computeSegmentStatistics(strokes)) == IntersectionStrategy::Planesweep);
+
+    std::vector<SegmentIntersection> intersections;
+    computeIntersections(strokes, intersections);
+    std::set<std::pair<size_t, size_t>> found;
+    for (const auto& intersection : intersections)
+    {
+        found.insert({intersection.firstSegment, intersection.secondSegment});
+    }
+    CHECK(found == getIntersectingPairs(strokes));
+    CHECK(found.count({2000, 2001}) == 1);
+}
@@ -0,0 +1,175 @@
+#include "executables/doctest.h"
+
+#include "algorithms/planesweep/planesweep.hpp"
+#include "algorithms/simplification/simplification.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <limits>
+#include <stdexcept>
+
+using namespace algorithms;
+using primitives::LineSegment;
+using primitives::Point;
+using primitives::Polygon;
+
+namespace
+{
+
+bool isSubsequence(const std::vector<Point>& subsequence, const std::vector<Point>& sequence)
+{
+    size_t i = 0;
+    for (const auto& point : sequence)
+    {
+        if (i < subsequence.size() && subsequence[i].x() == point.x() && subsequence[i].y() == point.y()) ++i;
+    }
+    return i == subsequence.size();
+}
+
+bool isSame(const std::vector<Point>& lhs, const std::vector<Point>& rhs)
+{
+    return lhs.size() == rhs.size() && isSubsequence(lhs, rhs);
+}
+
+std::vector<Point> getVertices(const Polygon& polygon)
+{
+    std::vector<Point> vertices;
+    for (size_t i = 0; i < polygon.size(); ++i)
+    {
+        vertices.push_back(polygon.getVertex(i));
+    }
+    return vertices;
+}
+
+// Band winding twice around the origin, whose turns come close to each other.
+Polygon makeSpiral()
+{
+    std::vector<Point> vertices;
+    const double pi = std::acos(-1.);
+    int numSteps = 100;
+    for (int i = 0; i <= numSteps; ++i)
+    {
+        double angle = 2. * pi + 4. * pi * i / numSteps;
+        vertices.emplace_back((angle + 2.) * std::cos(angle), (angle + 2.) * std::sin(angle));
+    }
+    for (int i = numSteps; i >= 0; --i)
+    {
+        double angle = 2. * pi + 4. * pi * i / numSteps;
+        vertices.emplace_back(angle * std::cos(angle), angle * std::sin(angle));
+    }
+    return Polygon(vertices);
+}
+
+} // namespace
+
+TEST_CASE("simplifyPolyline")
+{
+    // Zigzag with small teeth along a larger step.
+    std::vector<Point> polyline = {Point(0, 0), Point(1, .1), Point(2, 0), Point(3, .1), Point(4, 0),
+                                   Point(4, 3), Point(5, 3.1), Point(6, 3), Point(7, 3.1), Point(8, 3)};
+
+    for (auto method : {SimplificationMethod::DouglasPeucker, SimplificationMethod::Visvalingam})
+    {
+        // Keeps everything below the size of the teeth.
+        CHECK(simplifyPolyline(polyline, 1e-3, method, false).size() == polyline.size());
+
+        auto simplified = simplifyPolyline(polyline, .5, method, false);
+        REQUIRE(simplified.size() == 4);
+        CHECK(simplified[0].squareDistance(Point(0, 0)) == 0.);
+        CHECK(simplified[1].squareDistance(Point(4, 0)) == 0.);
+        CHECK(simplified[2].squareDistance(Point(4, 3)) == 0.);
+        CHECK(simplified[3].squareDistance(Point(8, 3)) == 0.);
+
+        // The end points are always kept.
+        auto line = simplifyPolyline(polyline, 1e9, method, false);
+        REQUIRE(line.size() == 2);
+        CHECK(line.front().squareDistance(polyline.front()) == 0.);
+        CHECK(line.back().squareDistance(polyline.back()) == 0.);
+    }
+
+    CHECK(simplifyPolyline({Point(0, 0), Point(1, 0)}, 1., SimplificationMethod::DouglasPeucker, true).size() == 2);
+}
+
+TEST_CASE("rankVertices")
+{
+    Polygon spiral = makeSpiral();
+    auto vertices = getVertices(spiral);
+    std::vector<double> tolerances = {16., .5, 4., 1., 100., 2., 0.};
+
+    for (auto method : {SimplificationMethod::DouglasPeucker, SimplificationMethod::Visvalingam})
+    {
+        auto ringImportances = rankVertices(vertices, true, method);
+        CHECK(std::count(ringImportances.begin(), ringImportances.end(), std::numeric_limits<double>::infinity()) == 3);
+
+        auto importances = rankVertices(vertices, false, method);
+        CHECK(std::count(importances.begin(), importances.end(), std::numeric_limits<double>::infinity()) == 2);
+
+        // Without preserving topology, every level is just a threshold on the ranking.
+        auto levels = simplifyPolyline(vertices, tolerances, method, false);
+        REQUIRE(levels.size() == tolerances.size());
+        for (size_t level = 0; level < levels.size(); ++level)
+        {
+            auto numImportant = std::count_if(importances.begin(), importances.end(),
+                                              [&](double importance) { return importance > tolerances[level]; });
+            CHECK(levels[level].size() == static_cast<size_t>(numImportant));
+            CHECK(isSame(levels[level], simplifyPolyline(vertices, tolerances[level], method, false)));
+        }
+    }
+
+    CHECK_THROWS_AS(rankVertices({Point(0, 0), Point(1, 0)}, true, SimplificationMethod::Visvalingam), std::invalid_argument);
+}
+
+TEST_CASE("simplifyPolygon - preserving topology")
+{
+    Polygon spiral = makeSpiral();
+    auto vertices = getVertices(spiral);
+
+    for (auto method : {SimplificationMethod::DouglasPeucker, SimplificationMethod::Visvalingam})
+    {
+        // Cuts across the turns of the spiral.
+        CHECK_THROWS_AS(simplifyPolygon(spiral, 16., method, false), std::logic_error);
+
+        std::vector<double> tolerances = {.5, 1., 2., 4., 8., 16.};
+        auto levels = simplifyPolygon(spiral, tolerances, method, true);
+        REQUIRE(levels.size() == tolerances.size());
+        for (size_t level = 0; level < levels.size(); ++level)
+        {
+            auto levelVertices = getVertices(levels[level]);
+            CHECK(levelVertices.size() < vertices.size());
+            CHECK(isSubsequence(levelVertices, vertices));
+            if (level > 0)
+            {
+                CHECK(isSubsequence(levelVertices, getVertices(levels[level - 1])));
+            }
+            // Still winds around the origin twice.
+            CHECK(levels[level].getSignedArea() == doctest::Approx(spiral.getSignedArea()).epsilon(.5));
+        }
+
+        // Just a triangle.
+        CHECK(simplifyPolygon(spiral, 1e9, method, true).size() == 3);
+    }
+}
+
+TEST_CASE("simplifyPolyline - preserving topology")
+{
+    // Dropping the peak at (5, 2) makes the first edge cross the edge from (10, -3) to (5, 1).
+    std::vector<Point> polyline = {Point(0, 0), Point(5, 2), Point(10, 0), Point(10, -3), Point(5, 1), Point(0, -3)};
+
+    auto simplified = simplifyPolyline(polyline, 2.5, SimplificationMethod::DouglasPeucker, false);
+    CHECK(simplified.size() == 5);
+    CHECK(std::none_of(simplified.begin(), simplified.end(), [](const Point& point) { return point.squareDistance(Point(5, 2)) == 0.; }));
+
+    auto preserved = simplifyPolyline(polyline, 2.5, SimplificationMethod::DouglasPeucker, true);
+    CHECK(isSame(preserved, polyline));
+
+    std::vector<LineSegment> edges;
+    for (size_t i = 0; i + 1 < simplified.size(); ++i)
+    {
+        edges.emplace_back(simplified[i], simplified[i + 1]);
+    }
+    CHECK(Planesweep(edges).findAnyIntersection(SharedEndPoints::AllowedBetweenConsecutive));
+
+    // A polyline crossing itself can't be simplified without crossings.
+    std::vector<Point> crossing = {Point(0, 0), Point(2, 2), Point(2, 0), Point(0, 2)};
+    CHECK_THROWS_AS(simplifyPolyline(crossing, 0., SimplificationMethod::Visvalingam, true), std::invalid_argument);
+}
@@ -0,0 +1,128 @@
+#include "executables/doctest.h"
+
+#include "algorithms/delaunay/spanningtree.hpp"
+#include "utility/disjointsets.hpp"
+
+#include <algorithm>
+#include <limits>
+#include <random>
+
+using namespace algorithms;
+
+namespace
+{
+
+std::vector<primitives::Point> getRandomPoints(size_t numPoints)
+{
+    std::mt19937 gen(2468);
+    std::uniform_real_distribution<double> coordDist(-10, 10);
+
+    std::vector<primitives::Point> points;
+    for (size_t i = 0; i < numPoints; ++i)
+    {
+        points.push_back(primitives::Point(coordDist(gen), coordDist(gen)));
+    }
+    return points;
+}
+
+double getTotalLength(const std::vector<primitives::Point>& points, const std::vector<Edge>& edges)
+{
+    double totalLength = 0;
+    for (const auto& [v1, v2] : edges)
+    {
+        totalLength += points[v1].distance(points[v2]);
+    }
+    return totalLength;
+}
+
+// Prim's algorithm on the complete graph.
+double getBruteForceTreeLength(const std::vector<primitives::Point>& points)
+{
+    std::vector<double> distanceToTree(points.size(), std::numeric_limits<double>::max());
+    std::vector<bool> isInTree(points.size(), false);
+    distanceToTree[0] = 0;
+    double totalLength = 0;
+    for (size_t i = 0; i < points.size(); ++i)
+    {
+        size_t next = 0;
+        double minDistance = std::numeric_limits<double>::max();
+        for (size_t v = 0; v < points.size(); ++v)
+        {
+            if (!isInTree[v] && distanceToTree[v] < minDistance)
+            {
+                minDistance = distanceToTree[v];
+                next = v;
+            }
+        }
+        isInTree[next] = true;
+        totalLength += minDistance;
+        for (size_t v = 0; v < points.size(); ++v)
+        {
+            distanceToTree[v] = std::min(distanceToTree[v], points[v].distance(points[next]));
+        }
+    }
+    return totalLength;
+}
+
+} // namespace
+
+TEST_CASE("DisjointSets")
+{
+    utility::DisjointSets sets(5);
+
+    CHECK(sets.unite(0, 1));
+    CHECK(sets.unite(3, 4));
+    CHECK(!sets.unite(1, 0));
+    CHECK(sets.find(0) == sets.find(1));
+    CHECK(sets.find(1) != sets.find(3));
+    CHECK(sets.unite(1, 4));
+    CHECK(sets.find(0) == sets.find(3));
+    CHECK(sets.find(2) == 2);
+}
+
+TEST_CASE("computeMinimumSpanningTree")
+{
+    auto points = getRandomPoints(150);
+    DelaunayTriangulator triangulator(points);
+    REQUIRE(triangulator.performTriangulation());
+
+    auto kruskalTree = computeMinimumSpanningTree(triangulator);
+    auto boruvkaTree = computeMinimumSpanningTreeParallel(triangulator, 4);
+
+    CHECK(kruskalTree.size() == points.size() - 1);
+    CHECK(getTotalLength(points, kruskalTree) == doctest::Approx(getBruteForceTreeLength(points)));
+    CHECK(boruvkaTree == kruskalTree);
+    CHECK(computeMinimumSpanningTreeParallel(triangulator, 1) == kruskalTree);
+
+    for (size_t e = 1; e < kruskalTree.size(); ++e)
+    {
+        CHECK(points[kruskalTree[e - 1].first].squareDistance(points[kruskalTree[e - 1].second])
+              <= points[kruskalTree[e].first].squareDistance(points[kruskalTree[e].second]));
+    }
+}
+
+TEST_CASE("computeNearestNeighbours and computeClosestPair")
+{
+    auto points = getRandomPoints(150);
+    DelaunayTriangulator triangulator(points);
+    REQUIRE(triangulator.performTriangulation());
+
+    auto nearestNeighbours = computeNearestNeighbours(triangulator, 3);
+    auto closestPair = computeClosestPair(triangulator);
+    REQUIRE(closestPair.has_value());
+
+    double minSquareDistance = std::numeric_limits<double>::max();
+    for (size_t v = 0; v < points.size(); ++v)
+    {
+        double nearestSquareDistance = std::numeric_limits<double>::max();
+        for (size_t w = 0; w < points.size(); ++w)
+        {
+            if (w != v) nearestSquareDistance = std::min(nearestSquareDistance, points[v].squareDistance(points[w]));
+        }
+        CHECK(points[v].squareDistance(points[nearestNeighbours[v]]) == doctest::Approx(nearestSquareDistance));
+        minSquareDistance = std::min(minSquareDistance, nearestSquareDistance);
+    }
+    CHECK(points[closestPair->first].squareDistance(points[closestPair->second]) == doctest::Approx(minSquareDistance));
+
+    CHECK(!computeClosestPair(DelaunayTriangulator(points)).has_value());
+}
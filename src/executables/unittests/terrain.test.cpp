@@ -0,0 +1,121 @@
+#include "executables/doctest.h"
+
+#include "algorithms/delaunay/terrain.hpp"
+
+#include <random>
+
+using namespace algorithms;
+
+namespace
+{
+
+std::vector<primitives::Point> getRandomPoints(size_t numPoints, double extent)
+{
+    std::mt19937 gen(4321);
+    std::uniform_real_distribution<double> coordDist(-extent, extent);
+
+    std::vector<primitives::Point> points;
+    for (size_t i = 0; i < numPoints; ++i)
+    {
+        points.push_back(primitives::Point(coordDist(gen), coordDist(gen)));
+    }
+    return points;
+}
+
+} // namespace
+
+TEST_CASE("TerrainTriangulation::getElevation")
+{
+    auto points = getRandomPoints(200, 5);
+    std::vector<double> elevations;
+    for (const auto& point : points)
+    {
+        elevations.push_back(point.x() + 2 * point.y());
+    }
+
+    CHECK_THROWS(TerrainTriangulation(points, {1., 2.}));
+
+    TerrainTriangulation terrain(points, elevations);
+
+    // A plane is reproduced exactly by linear interpolation.
+    for (const auto& query : getRandomPoints(50, 2))
+    {
+        auto elevation = terrain.getElevation(query);
+        REQUIRE(elevation.has_value());
+        CHECK(*elevation == doctest::Approx(query.x() + 2 * query.y()));
+    }
+    CHECK(*terrain.getElevation(points[7]) == doctest::Approx(elevations[7]));
+    CHECK(!terrain.getElevation(primitives::Point(10, 10)).has_value());
+    CHECK(!terrain.getElevation(primitives::Point(-6, 0)).has_value());
+}
+
+TEST_CASE("TerrainTriangulation::computeContours plane")
+{
+    auto points = getRandomPoints(300, 5);
+    std::vector<double> elevations;
+    for (const auto& point : points)
+    {
+        elevations.push_back(point.x() + 2 * point.y());
+    }
+    TerrainTriangulation terrain(points, elevations);
+
+    auto contours = terrain.computeContours({2., -1., 0., 1.}, 3);
+
+    REQUIRE(contours.levels == std::vector<double>{-1., 0., 1., 2.});
+    REQUIRE(contours.levelOffsets.size() == 5);
+    for (size_t l = 0; l < contours.levels.size(); ++l)
+    {
+        // Every straight slice through the convex terrain is a single open polyline.
+        REQUIRE(contours.levelOffsets[l + 1] - contours.levelOffsets[l] == 1);
+        size_t polyline = contours.levelOffsets[l];
+        CHECK(!contours.isClosed[polyline]);
+        CHECK(contours.polylineOffsets[polyline + 1] - contours.polylineOffsets[polyline] > 2);
+
+        for (size_t p = contours.polylineOffsets[polyline]; p < contours.polylineOffsets[polyline + 1]; ++p)
+        {
+            CHECK(contours.points[p].x() + 2 * contours.points[p].y() == doctest::Approx(contours.levels[l]));
+        }
+
+        // Higher ground to the left.
+        const auto& first = contours.points[contours.polylineOffsets[polyline]];
+        const auto& last = contours.points[contours.polylineOffsets[polyline + 1] - 1];
+        CHECK(-(last.y() - first.y()) * 1. + (last.x() - first.x()) * 2. > 0);
+    }
+}
+
+TEST_CASE("TerrainTriangulation::computeContours hill")
+{
+    auto points = getRandomPoints(400, 3);
+    std::vector<double> elevations;
+    for (const auto& point : points)
+    {
+        elevations.push_back(10 - point.squareNorm());
+    }
+    TerrainTriangulation terrain(points, elevations);
+
+    auto contours = terrain.computeContours({6., 8.});
+
+    for (size_t l = 0; l < contours.levels.size(); ++l)
+    {
+        REQUIRE(contours.levelOffsets[l + 1] - contours.levelOffsets[l] == 1);
+        size_t polyline = contours.levelOffsets[l];
+        CHECK(contours.isClosed[polyline]);
+
+        double signedArea = 0;
+        size_t begin = contours.polylineOffsets[polyline];
+        size_t end = contours.polylineOffsets[polyline + 1];
+        for (size_t p = begin; p < end; ++p)
+        {
+            const auto& curr = contours.points[p];
+            const auto& next = contours.points[p + 1 < end ? p + 1 : begin];
+            signedArea += curr.x() * next.y() - next.x() * curr.y();
+            CHECK(curr.norm() == doctest::Approx(std::sqrt(10 - contours.levels[l])).epsilon(0.1));
+        }
+        // Higher ground to the left means counter-clockwise around a hill.
+        CHECK(signedArea > 0);
+    }
+
+    auto noContours = terrain.computeContours({20.});
+    CHECK(noContours.levelOffsets == std::vector<size_t>{0, 0});
+    CHECK(noContours.points.empty());
+}
@@ -0,0 +1,110 @@
+#include "executables/doctest.h"
+
+#include "algorithms/delaunay/topology.hpp"
+
+#include <algorithm>
+#include <iterator>
+#include <random>
+#include <ranges>
+
+using namespace algorithms;
+
+static_assert(std::ranges::forward_range<VertexRing>);
+static_assert(std::ranges::forward_range<IncidentTriangles>);
+
+namespace
+{
+
+TriangulationTopology getSquareWithCenter()
+{
+    DelaunayTriangulator triangulator(std::vector<primitives::Point>{primitives::Point(1.3, 1.7), primitives::Point(3.3, 1.7),
+                                                                     primitives::Point(3.3, 3.7), primitives::Point(1.3, 3.7),
+                                                                     primitives::Point(2.2, 2.9)});
+    REQUIRE(triangulator.performTriangulation());
+
+    return TriangulationTopology(triangulator.getTriangulation());
+}
+
+} // namespace
+
+TEST_CASE("TriangulationTopology vertex ring")
+{
+    auto topology = getSquareWithCenter();
+
+    std::vector<size_t> centerRing;
+    std::ranges::copy(topology.getVertexRing(4), std::back_inserter(centerRing));
+    REQUIRE(centerRing.size() == 4);
+    std::rotate(centerRing.begin(), std::find(centerRing.begin(), centerRing.end(), 0), centerRing.end());
+    CHECK(centerRing == std::vector<size_t>{0, 1, 2, 3});
+    CHECK(!topology.isBoundaryVertex(4));
+
+    std::vector<size_t> cornerRing;
+    for (auto neighbour : topology.getVertexRing(0))
+    {
+        cornerRing.push_back(neighbour);
+    }
+    CHECK(cornerRing == std::vector<size_t>{1, 4, 3});
+    CHECK(topology.isBoundaryVertex(0));
+
+    CHECK(std::ranges::distance(topology.getIncidentTriangles(4)) == 4);
+    CHECK(std::ranges::distance(topology.getIncidentTriangles(0)) == 2);
+    CHECK(std::ranges::find(topology.getVertexRing(2), 0) == std::default_sentinel);
+}
+
+TEST_CASE("TriangulationTopology triangle neighbours")
+{
+    auto topology = getSquareWithCenter();
+
+    CHECK(topology.getNumTriangles() == 4);
+    CHECK(topology.getEdges().size() == 8);
+    for (size_t t = 0; t < topology.getNumTriangles(); ++t)
+    {
+        auto neighbours = topology.getTriangleNeighbours(t);
+        CHECK(std::count(neighbours.begin(), neighbours.end(), NoTriangle) == 1);
+
+        for (size_t k = 0; k < 3; ++k)
+        {
+            size_t opposite = topology.getOppositeTriangle(t, k);
+            if (opposite == NoTriangle) continue;
+
+            // The neighbour shares the edge, traversed in the opposite direction.
+            size_t from = topology.getCorner(t, k);
+            size_t to = topology.getCorner(t, (k + 1) % 3);
+            size_t localIdx = topology.getLocalIndex(opposite, to);
+            CHECK(topology.getCorner(opposite, (localIdx + 1) % 3) == from);
+            CHECK(topology.getEdgeIndex(3 * t + k) == topology.getEdgeIndex(3 * opposite + localIdx));
+        }
+    }
+    CHECK_THROWS(topology.getLocalIndex(0, 42));
+}
+
+TEST_CASE("TriangulationTopology random triangulation")
+{
+    std::mt19937 gen(97531);
+    std::uniform_real_distribution<double> coordDist(-10, 10);
+    std::vector<primitives::Point> points;
+    for (int i = 0; i < 100; ++i)
+    {
+        points.push_back(primitives::Point(coordDist(gen), coordDist(gen)));
+    }
+    DelaunayTriangulator triangulator(points);
+    REQUIRE(triangulator.performTriangulation());
+    TriangulationTopology topology(triangulator.getTriangulation());
+
+    size_t numIncidences = 0;
+    for (size_t v = 0; v < points.size(); ++v)
+    {
+        auto numTriangles = std::ranges::distance(topology.getIncidentTriangles(v));
+        auto numNeighbours = std::ranges::distance(topology.getVertexRing(v));
+        CHECK(numNeighbours == numTriangles + (topology.isBoundaryVertex(v) ? 1 : 0));
+        CHECK(static_cast<size_t>(numNeighbours) == triangulator.getEdges().count(v));
+        numIncidences += numTriangles;
+
+        for (auto t : topology.getIncidentTriangles(v))
+        {
+            CHECK_NOTHROW(topology.getLocalIndex(t, v));
+        }
+    }
+    CHECK(numIncidences == 3 * topology.getNumTriangles());
+    CHECK(2 * topology.getEdges().size() == triangulator.getEdges().size());
+}
@@ -156,6 +156,12 @@ LineLineIntersection LineSegment::computeIntersection(const LineSegment& otherLi
             glm::dvec2 startPointOut(std::max(0., std::min(secondStartPointTransformed.x, secondEndPointTransformed.x)), 0.);
             glm::dvec2 endPointOut(std::min(length(), std::max(secondStartPointTransformed.x, secondEndPointTransformed.x)), 0.);
 
+            if (endPointOut.x - startPointOut.x < 1e-3)
+            {
+                // Colinear lines only touching in an end point, which would make a degenerate line segment.
+                return utility::toPoint(transformBackToGlobalCoordinates(startPointOut));
+            }
+
             return LineSegment(utility::toPoint(transformBackToGlobalCoordinates(startPointOut)), 
                                utility::toPoint(transformBackToGlobalCoordinates(endPointOut)));
         }
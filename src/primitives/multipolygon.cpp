@@ -0,0 +1,373 @@
+#include "multipolygon.hpp"
+
+#include <algorithm>
+#include <cmath>
+#include <numeric>
+#include <optional>
+#include <stdexcept>
+#include <tuple>
+#include <variant>
+
+#include "algorithms/planesweep/planesweep.hpp"
+#include "polygonindex.hpp"
+#include "utility/geomutils.hpp"
+
+namespace primitives
+{
+
+namespace
+{
+
+std::vector<Point> collectCoordinates(const std::vector<PolygonWithHoles>& polygons)
+{
+    std::vector<Point> coordinates;
+    auto addRing = [&coordinates](const Polygon& ring)
+    {
+        for (size_t i = 0; i < ring.size(); ++i)
+        {
+            coordinates.push_back(ring.getVertex(i));
+        }
+    };
+    for (const auto& polygon : polygons)
+    {
+        addRing(polygon.outer);
+        for (const auto& hole : polygon.holes)
+        {
+            addRing(hole);
+        }
+    }
+    return coordinates;
+}
+
+std::vector<size_t> collectRingOffsets(const std::vector<PolygonWithHoles>& polygons)
+{
+    std::vector<size_t> ringOffsets = {0};
+    for (const auto& polygon : polygons)
+    {
+        ringOffsets.push_back(ringOffsets.back() + polygon.outer.size());
+        for (const auto& hole : polygon.holes)
+        {
+            ringOffsets.push_back(ringOffsets.back() + hole.size());
+        }
+    }
+    return ringOffsets;
+}
+
+std::vector<size_t> collectPolygonRingOffsets(const std::vector<PolygonWithHoles>& polygons)
+{
+    std::vector<size_t> polygonRingOffsets = {0};
+    for (const auto& polygon : polygons)
+    {
+        polygonRingOffsets.push_back(polygonRingOffsets.back() + 1 + polygon.holes.size());
+    }
+    return polygonRingOffsets;
+}
+
+} // namespace
+
+MultiPolygon::MultiPolygon(std::vector<Point> coordinates, std::vector<size_t> ringOffsets, std::vector<size_t> polygonRingOffsets)
+    : m_coordinates(std::move(coordinates))
+    , m_ringOffsets(std::move(ringOffsets))
+    , m_polygonRingOffsets(std::move(polygonRingOffsets))
+{
+    if (m_ringOffsets.empty() || m_ringOffsets.front() != 0 || m_ringOffsets.back() != m_coordinates.size())
+    {
+        throw std::invalid_argument("Ring offsets must start with 0 and end with the number of coordinates.");
+    }
+    if (m_polygonRingOffsets.empty() || m_polygonRingOffsets.front() != 0 || m_polygonRingOffsets.back() != getNumRings())
+    {
+        throw std::invalid_argument("Polygon ring offsets must start with 0 and end with the number of rings.");
+    }
+    for (size_t r = 0; r < getNumRings(); ++r)
+    {
+        if (m_ringOffsets[r] + 3 > m_ringOffsets[r + 1])
+        {
+            throw std::invalid_argument("Every ring needs at least three vertices.");
+        }
+    }
+    for (size_t p = 0; p < getNumPolygons(); ++p)
+    {
+        if (m_polygonRingOffsets[p] >= m_polygonRingOffsets[p + 1])
+        {
+            throw std::invalid_argument("Every polygon needs an outer boundary.");
+        }
+    }
+
+    m_nextVertices.resize(m_coordinates.size());
+    for (size_t p = 0; p < getNumPolygons(); ++p)
+    {
+        for (size_t r = m_polygonRingOffsets[p]; r < m_polygonRingOffsets[p + 1]; ++r)
+        {
+            bool isOuter = r == m_polygonRingOffsets[p];
+            if ((getRingSignedArea(r) > 0.) != isOuter)
+            {
+                std::reverse(m_coordinates.begin() + m_ringOffsets[r], m_coordinates.begin() + m_ringOffsets[r + 1]);
+            }
+            for (size_t v = m_ringOffsets[r]; v + 1 < m_ringOffsets[r + 1]; ++v)
+            {
+                m_nextVertices[v] = v + 1;
+            }
+            m_nextVertices[m_ringOffsets[r + 1] - 1] = m_ringOffsets[r];
+        }
+    }
+
+    // Edges always share their end points with their neighbours. Other edges, also of other rings, are allowed
+    // to touch in vertices, but not to intersect in interior points or to overlap.
+    algorithms::Planesweep planesweep(getEdges());
+    auto intersection = planesweep.findAnyIntersection(algorithms::SharedEndPoints::Allowed);
+    if (intersection)
+    {
+        if (std::holds_alternative<LineSegment>(intersection->intersection))
+        {
+            throw std::logic_error("Two edges intersect in line");
+        }
+        throw std::logic_error("Two edges intersected in interior point");
+    }
+
+    checkRingNesting();
+}
+
+MultiPolygon::MultiPolygon(const std::vector<PolygonWithHoles>& polygons)
+    : MultiPolygon(collectCoordinates(polygons), collectRingOffsets(polygons), collectPolygonRingOffsets(polygons))
+{
+}
+
+std::vector<LineSegment> MultiPolygon::getEdges() const
+{
+    std::vector<LineSegment> edges;
+    edges.reserve(m_coordinates.size());
+    for (size_t v = 0; v < m_coordinates.size(); ++v)
+    {
+        edges.emplace_back(m_coordinates[v], m_coordinates[m_nextVertices[v]]);
+    }
+    return edges;
+}
+
+bool MultiPolygon::contains(const Point& point) const
+{
+    int windingNumber = 0;
+    for (size_t v = 0; v < m_coordinates.size(); ++v)
+    {
+        const auto& start = m_coordinates[v];
+        const auto& end = m_coordinates[m_nextVertices[v]];
+        if (utility::getSquareDistanceToSegment(point, start, end) <= 1e-10)
+        {
+            // Point lies on boundary; we consider it contained
+            return true;
+        }
+        windingNumber += utility::getWindingNumberStep(point, start, end);
+    }
+
+    return windingNumber != 0;
+}
+
+double MultiPolygon::getArea() const
+{
+    double area = 0.;
+    for (size_t r = 0; r < getNumRings(); ++r)
+    {
+        area += getRingSignedArea(r);
+    }
+    return area;
+}
+
+double MultiPolygon::getPolygonArea(size_t polygon) const
+{
+    double area = 0.;
+    for (size_t r = m_polygonRingOffsets.at(polygon); r < m_polygonRingOffsets[polygon + 1]; ++r)
+    {
+        area += getRingSignedArea(r);
+    }
+    return area;
+}
+
+PolygonWithHoles MultiPolygon::getPolygonWithHoles(size_t polygon) const
+{
+    auto getRing = [this](size_t ring)
+    {
+        return Polygon(std::vector<Point>(m_coordinates.begin() + m_ringOffsets[ring], m_coordinates.begin() + m_ringOffsets[ring + 1]));
+    };
+
+    size_t outerRing = m_polygonRingOffsets.at(polygon);
+    PolygonWithHoles result{getRing(outerRing), {}};
+    for (size_t r = outerRing + 1; r < m_polygonRingOffsets[polygon + 1]; ++r)
+    {
+        result.holes.push_back(getRing(r));
+    }
+    return result;
+}
+
+Point MultiPolygon::getRingMidpoint(size_t ring) const
+{
+    const auto& start = m_coordinates[m_ringOffsets[ring]];
+    const auto& end = m_coordinates[m_ringOffsets[ring] + 1];
+    return Point((start.x() + end.x()) / 2., (start.y() + end.y()) / 2.);
+}
+
+bool MultiPolygon::isInsideRing(const Point& point, size_t ring) const
+{
+    int windingNumber = 0;
+    for (size_t v = m_ringOffsets[ring]; v < m_ringOffsets[ring + 1]; ++v)
+    {
+        windingNumber += utility::getWindingNumberStep(point, m_coordinates[v], m_coordinates[m_nextVertices[v]]);
+    }
+    return windingNumber != 0;
+}
+
+void MultiPolygon::checkRingNesting() const
+{
+    // A ring is inside another one if the midpoint of one of its edges is. Only the rings whose bounding box
+    // contains the midpoint are tested, found in a uniform grid with about as many cells as rings, where every
+    // ring is stored in the cells its bounding box overlaps.
+    size_t numRings = getNumRings();
+    if (numRings < 2) return;
+
+    std::vector<size_t> ringPolygons(numRings);
+    for (size_t p = 0; p < getNumPolygons(); ++p)
+    {
+        std::fill(ringPolygons.begin() + m_polygonRingOffsets[p], ringPolygons.begin() + m_polygonRingOffsets[p + 1], p);
+    }
+
+    // (min x, min y, max x, max y) per ring.
+    std::vector<std::tuple<double, double, double, double>> boxes(numRings);
+    double minX = m_coordinates[0].x();
+    double minY = m_coordinates[0].y();
+    double maxX = minX;
+    double maxY = minY;
+    for (size_t r = 0; r < numRings; ++r)
+    {
+        auto& [boxMinX, boxMinY, boxMaxX, boxMaxY] = boxes[r];
+        boxMinX = boxMaxX = m_coordinates[m_ringOffsets[r]].x();
+        boxMinY = boxMaxY = m_coordinates[m_ringOffsets[r]].y();
+        for (size_t v = m_ringOffsets[r]; v < m_ringOffsets[r + 1]; ++v)
+        {
+            boxMinX = std::min(boxMinX, m_coordinates[v].x());
+            boxMinY = std::min(boxMinY, m_coordinates[v].y());
+            boxMaxX = std::max(boxMaxX, m_coordinates[v].x());
+            boxMaxY = std::max(boxMaxY, m_coordinates[v].y());
+        }
+        minX = std::min(minX, boxMinX);
+        minY = std::min(minY, boxMinY);
+        maxX = std::max(maxX, boxMaxX);
+        maxY = std::max(maxY, boxMaxY);
+    }
+
+    size_t numCellsPerAxis = static_cast<size_t>(std::ceil(std::sqrt(static_cast<double>(numRings))));
+    double cellWidth = std::max(maxX - minX, 1e-10) / numCellsPerAxis;
+    double cellHeight = std::max(maxY - minY, 1e-10) / numCellsPerAxis;
+    auto getColumn = [&](double x) { return std::min(static_cast<size_t>(std::max(0., (x - minX) / cellWidth)), numCellsPerAxis - 1); };
+    auto getRow = [&](double y) { return std::min(static_cast<size_t>(std::max(0., (y - minY) / cellHeight)), numCellsPerAxis - 1); };
+
+    std::vector<std::pair<size_t, size_t>> cellRingPairs;
+    for (size_t r = 0; r < numRings; ++r)
+    {
+        const auto& [boxMinX, boxMinY, boxMaxX, boxMaxY] = boxes[r];
+        for (size_t row = getRow(boxMinY); row <= getRow(boxMaxY); ++row)
+        {
+            for (size_t column = getColumn(boxMinX); column <= getColumn(boxMaxX); ++column)
+            {
+                cellRingPairs.emplace_back(row * numCellsPerAxis + column, r);
+            }
+        }
+    }
+
+    size_t numCells = numCellsPerAxis * numCellsPerAxis;
+    std::vector<size_t> cellRingOffsets(numCells + 1, 0);
+    for (const auto& [cell, ring] : cellRingPairs)
+    {
+        ++cellRingOffsets[cell + 1];
+    }
+    std::partial_sum(cellRingOffsets.begin(), cellRingOffsets.end(), cellRingOffsets.begin());
+    std::vector<size_t> cellRings(cellRingPairs.size());
+    std::vector<size_t> cellFill(cellRingOffsets.begin(), cellRingOffsets.end() - 1);
+    for (const auto& [cell, ring] : cellRingPairs)
+    {
+        cellRings[cellFill[cell]++] = ring;
+    }
+
+    // Containment in a ring is first tested with an index of the ring, built on first use, so that rings with
+    // many vertices are not traversed again for every ring inside them. The index counts points near the ring as
+    // inside, so the exact test confirms this before a ring is rejected.
+    std::vector<std::optional<PolygonContainmentIndex>> ringIndices(numRings);
+    auto isInsideBoxAndRing = [&](const Point& point, size_t ring)
+    {
+        const auto& [boxMinX, boxMinY, boxMaxX, boxMaxY] = boxes[ring];
+        if (point.x() < boxMinX || point.x() > boxMaxX || point.y() < boxMinY || point.y() > boxMaxY)
+        {
+            return false;
+        }
+        if (!ringIndices[ring])
+        {
+            ringIndices[ring].emplace(*this, ring);
+        }
+        return ringIndices[ring]->contains(point);
+    };
+
+    for (size_t r = 0; r < numRings; ++r)
+    {
+        size_t polygon = ringPolygons[r];
+        size_t outerRing = m_polygonRingOffsets[polygon];
+        auto midpoint = getRingMidpoint(r);
+        size_t cell = getRow(midpoint.y()) * numCellsPerAxis + getColumn(midpoint.x());
+
+        if (r != outerRing)
+        {
+            // As no edges cross, a hole is either completely inside or completely outside of the outer boundary
+            // and of the other holes, and the midpoints of its edges are on neither of them.
+            if (!isInsideBoxAndRing(midpoint, outerRing))
+            {
+                throw std::logic_error("Hole is not inside the outer boundary of its polygon");
+            }
+            for (size_t i = cellRingOffsets[cell]; i < cellRingOffsets[cell + 1]; ++i)
+            {
+                size_t other = cellRings[i];
+                if (other != r && other != outerRing && ringPolygons[other] == polygon
+                    && isInsideBoxAndRing(midpoint, other) && isInsideRing(midpoint, other))
+                {
+                    throw std::logic_error("Hole is inside another hole of its polygon");
+                }
+            }
+            continue;
+        }
+
+        // An outer boundary may lie inside another polygon only if it also lies inside one of its holes.
+        for (size_t i = cellRingOffsets[cell]; i < cellRingOffsets[cell + 1]; ++i)
+        {
+            size_t otherOuterRing = cellRings[i];
+            size_t otherPolygon = ringPolygons[otherOuterRing];
+            if (otherPolygon == polygon || otherOuterRing != m_polygonRingOffsets[otherPolygon]
+                || !isInsideBoxAndRing(midpoint, otherOuterRing))
+            {
+                continue;
+            }
+
+            // The holes containing the midpoint also have their bounding boxes in this cell.
+            bool isInsideHole = false;
+            for (size_t j = cellRingOffsets[cell]; j < cellRingOffsets[cell + 1] && !isInsideHole; ++j)
+            {
+                size_t hole = cellRings[j];
+                isInsideHole = hole != otherOuterRing && ringPolygons[hole] == otherPolygon && isInsideBoxAndRing(midpoint, hole);
+            }
+            if (!isInsideHole && isInsideRing(midpoint, otherOuterRing))
+            {
+                throw std::logic_error("Polygon is inside another polygon");
+            }
+        }
+    }
+}
+
+double MultiPolygon::getRingSignedArea(size_t ring) const
+{
+    double doubleArea = 0.;
+    size_t ringBegin = m_ringOffsets[ring];
+    size_t ringEnd = m_ringOffsets[ring + 1];
+    for (size_t v = ringBegin; v < ringEnd; ++v)
+    {
+        const auto& vertex = m_coordinates[v];
+        const auto& nextVertex = m_coordinates[v + 1 < ringEnd ? v + 1 : ringBegin];
+        doubleArea += vertex.x() * nextVertex.y() - nextVertex.x() * vertex.y();
+    }
+    return doubleArea / 2.;
+}
+
+} // namespace primitives
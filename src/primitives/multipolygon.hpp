@@ -0,0 +1,67 @@
+#ifndef MULTIPOLYGON_HPP_INCLUDED
+#define MULTIPOLYGON_HPP_INCLUDED
+
+#include <vector>
+
+#include "point.hpp"
+#include "linesegment.hpp"
+#include "polygon.hpp"
+
+namespace primitives
+{
+
+// Set of polygons with holes in flat storage: all vertices in a single coordinate buffer, split into rings by
+// ring offsets, which in turn are grouped into polygons by polygon offsets. The first ring of every polygon is
+// its outer boundary, the others are its holes.
+//
+// Rings may touch each other in vertices, but no two edges may cross or overlap. Holes lie inside the outer
+// boundary of their polygon and not inside each other, and no polygon lies in the interior of another one,
+// though it may lie in one of its holes (an island in a lake). Outer boundaries are stored counterclockwise
+// and holes clockwise, reversing rings given the other way round.
+struct MultiPolygon
+{
+    // Ring r consists of coordinates[ringOffsets[r]] to coordinates[ringOffsets[r + 1] - 1] and polygon p of rings
+    // polygonRingOffsets[p] to polygonRingOffsets[p + 1] - 1, so both offset arrays start with 0 and end with the
+    // number of coordinates resp. rings. All edges are checked for intersections in a single sweep, and every ring
+    // is checked to be nested as described above.
+    MultiPolygon(std::vector<Point> coordinates, std::vector<size_t> ringOffsets, std::vector<size_t> polygonRingOffsets);
+    MultiPolygon(const std::vector<PolygonWithHoles>& polygons);
+
+    size_t getNumPolygons() const { return m_polygonRingOffsets.size() - 1; }
+    size_t getNumRings() const { return m_ringOffsets.size() - 1; }
+    size_t getNumVertices() const { return m_coordinates.size(); }
+
+    const std::vector<Point>& getCoordinates() const { return m_coordinates; }
+    const std::vector<size_t>& getRingOffsets() const { return m_ringOffsets; }
+    const std::vector<size_t>& getPolygonRingOffsets() const { return m_polygonRingOffsets; }
+
+    // The vertex following <vertex> on its ring, i. e., edge <vertex> goes from vertex <vertex> to this one.
+    size_t getNextVertex(size_t vertex) const { return m_nextVertices[vertex]; }
+    // All edges, with edge i starting at vertex i.
+    std::vector<LineSegment> getEdges() const;
+
+    // Same semantics as Polygon::contains, i. e., points on the boundary are contained.
+    bool contains(const Point& point) const;
+    // Area of all polygons, excluding their holes.
+    double getArea() const;
+    double getPolygonArea(size_t polygon) const;
+    PolygonWithHoles getPolygonWithHoles(size_t polygon) const;
+
+private:
+    double getRingSignedArea(size_t ring) const;
+    // Midpoint of the first edge of the ring, which is on no other ring, as no edges cross.
+    Point getRingMidpoint(size_t ring) const;
+    bool isInsideRing(const Point& point, size_t ring) const;
+    // Throws if a hole is outside of the outer boundary of its polygon or inside another hole of it, or if an
+    // outer boundary is inside another polygon without being inside one of its holes.
+    void checkRingNesting() const;
+
+    std::vector<Point> m_coordinates;
+    std::vector<size_t> m_ringOffsets;
+    std::vector<size_t> m_polygonRingOffsets;
+    std::vector<size_t> m_nextVertices;
+};
+
+} // namespace primitives
+
+#endif
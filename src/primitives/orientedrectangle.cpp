@@ -0,0 +1,46 @@
+#include "orientedrectangle.hpp"
+
+#include <cmath>
+#include <stdexcept>
+
+namespace primitives
+{
+
+OrientedRectangle::OrientedRectangle(Point center, Point axis, double width, double height)
+    : m_center(center)
+    , m_width(width)
+    , m_height(height)
+{
+    double norm = axis.norm();
+    if (norm == 0.)
+    {
+        throw std::invalid_argument("Axis of rectangle must not be zero.");
+    }
+    if (width < 0. || height < 0.)
+    {
+        throw std::invalid_argument("Width and height of rectangle must not be negative.");
+    }
+    m_axis = Point(axis.x() / norm, axis.y() / norm);
+}
+
+std::array<Point, 4> OrientedRectangle::getCorners() const
+{
+    // Half sides along and perpendicular to the axis.
+    Point along(m_axis.x() * m_width / 2., m_axis.y() * m_width / 2.);
+    Point across(-m_axis.y() * m_height / 2., m_axis.x() * m_height / 2.);
+    return {Point(m_center.x() - along.x() - across.x(), m_center.y() - along.y() - across.y()),
+            Point(m_center.x() + along.x() - across.x(), m_center.y() + along.y() - across.y()),
+            Point(m_center.x() + along.x() + across.x(), m_center.y() + along.y() + across.y()),
+            Point(m_center.x() - along.x() + across.x(), m_center.y() - along.y() + across.y())};
+}
+
+bool OrientedRectangle::contains(const Point& point) const
+{
+    double offsetX = point.x() - m_center.x();
+    double offsetY = point.y() - m_center.y();
+    double alongAxis = offsetX * m_axis.x() + offsetY * m_axis.y();
+    double acrossAxis = offsetY * m_axis.x() - offsetX * m_axis.y();
+    return std::abs(alongAxis) <= m_width / 2. + 1e-5 && std::abs(acrossAxis) <= m_height / 2. + 1e-5;
+}
+
+} // namespace primitives
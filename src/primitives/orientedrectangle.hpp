@@ -0,0 +1,42 @@
+#ifndef ORIENTEDRECTANGLE_HPP_INCLUDED
+#define ORIENTEDRECTANGLE_HPP_INCLUDED
+
+#include <array>
+
+#include "point.hpp"
+
+namespace primitives
+{
+
+// Rectangle around <center> with sides of length width along <axis> and of length height perpendicular to it.
+// Width or height may be 0 for the bounding rectangle of a line segment or a point.
+struct OrientedRectangle
+{
+    // The axis is normalised and must not be zero.
+    OrientedRectangle(Point center, Point axis, double width, double height);
+
+    Point getCenter() const { return m_center; }
+    // Unit vector along the sides of length width.
+    Point getAxis() const { return m_axis; }
+    double getWidth() const { return m_width; }
+    double getHeight() const { return m_height; }
+
+    double getArea() const { return m_width * m_height; }
+    double getPerimeter() const { return 2. * (m_width + m_height); }
+    // In counterclockwise order, starting at the corner with the smallest coordinates along the axis and
+    // perpendicular to it.
+    std::array<Point, 4> getCorners() const;
+
+    // Points up to 1e-5 outside of the rectangle count as contained, as for Polygon::contains.
+    bool contains(const Point& point) const;
+
+private:
+    Point m_center;
+    Point m_axis;
+    double m_width;
+    double m_height;
+};
+
+} // namespace primitives
+
+#endif // ORIENTEDRECTANGLE_HPP_INCLUDED
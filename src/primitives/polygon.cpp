@@ -2,6 +2,7 @@
 
 #include "linesegment.hpp"
 #include "algorithms/planesweep/planesweep.hpp"
+#include "utility/geomutils.hpp"
 
 #include <iostream>
 #include <algorithm>
@@ -24,52 +25,50 @@ Polygon::Polygon(const std::vector<Point>& vertices)
         edges.push_back(getEdge(i));
     }
 
+    // Edges always share their end points with their neighbours. Other edges are allowed to
+    // touch in vertices, but not to intersect in interior points or to overlap.
     algorithms::Planesweep planesweep(edges);
-    auto intersections = planesweep.perform();
+    auto intersection = planesweep.findAnyIntersection(algorithms::SharedEndPoints::Allowed);
 
-    for (const auto& inter : intersections)
+    if (intersection)
     {
-        auto computedInter = inter.first.computeIntersection(inter.second);
-        if (std::holds_alternative<std::monostate>(computedInter))
-        {
-            // Unexpected -- gobling up error. Yum yum yum
-            continue;
-        }
-        if (std::holds_alternative<LineSegment>(computedInter))
+        if (std::holds_alternative<LineSegment>(intersection->intersection))
         {
             throw std::logic_error("Two edges intersect in line");
         }
-        auto intersectionPoint = std::get<Point>(computedInter);
-        if (intersectionPoint.squareDistance(inter.first.getStartPoint()) > 1e-12*1e-12 && intersectionPoint.squareDistance(inter.first.getEndPoint()) > 1e-12*1e-12)
-        {
-            throw std::logic_error("Two edges intersected in interior point");
-        }
+        throw std::logic_error("Two edges intersected in interior point");
     }
 }
 
-bool Polygon::contains(const Point& point)
+bool Polygon::contains(const Point& point) const
 {
     int windingNumber = 0;
     for (size_t i = 0; i < m_vertices.size(); ++i)
     {
-        auto edge = getEdge(i);
-        if (projectPointOnLine(point, edge).squareDistance(point) <= 1e-10)
+        const auto& start = m_vertices[i];
+        const auto& end = m_vertices[(i + 1) % m_vertices.size()];
+        if (utility::getSquareDistanceToSegment(point, start, end) <= 1e-10)
         {
             // Point lies on boundary; we consider it contained
             return true;
         }
 
-        double verMaxX = std::max(edge.getStartPoint().x(), edge.getEndPoint().x());
-        if (verMaxX < point.x()) continue;
-        auto raySegment = LineSegment(point, Point(verMaxX + std::abs(verMaxX) + 16, point.y()));
-
-        if (raySegment.intersects(edge))
-        {
-            windingNumber += edge.getStartPoint().y() < edge.getEndPoint().y() ? 1 : -1;
-        }
+        windingNumber += utility::getWindingNumberStep(point, start, end);
     }
 
     return windingNumber != 0;
 }
 
+double Polygon::getSignedArea() const
+{
+    double doubleArea = 0.;
+    for (size_t i = 0; i < m_vertices.size(); ++i)
+    {
+        const auto& vertex = m_vertices[i];
+        const auto& nextVertex = m_vertices[(i + 1) % m_vertices.size()];
+        doubleArea += vertex.x() * nextVertex.y() - nextVertex.x() * vertex.y();
+    }
+    return doubleArea / 2.;
+}
+
 } // namespace primitives
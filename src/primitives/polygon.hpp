@@ -13,17 +13,27 @@ struct Polygon
 {
     Polygon(const std::vector<Point>& vertices);
     
-    size_t size() { return m_vertices.size(); }
-    Point getVertex(size_t idx) {return m_vertices.at(idx); }
+    size_t size() const { return m_vertices.size(); }
+    Point getVertex(size_t idx) const {return m_vertices.at(idx); }
     // Returns edge starting at vertex <idx>
-    LineSegment getEdge(size_t idx) { return LineSegment(getVertex(idx), getVertex((idx + 1) % m_vertices.size())); }
+    LineSegment getEdge(size_t idx) const { return LineSegment(getVertex(idx), getVertex((idx + 1) % m_vertices.size())); }
 
-    bool contains(const Point& point);
+    bool contains(const Point& point) const;
+    // Positive if the vertices are in counterclockwise order.
+    double getSignedArea() const;
 
 private:
     std::vector<Point> m_vertices;
 };
 
+// Outer boundary and the boundaries of the holes inside it. The holes don't overlap each other, but may
+// touch each other and the outer boundary in vertices.
+struct PolygonWithHoles
+{
+    Polygon outer;
+    std::vector<Polygon> holes;
+};
+
 }
 
 
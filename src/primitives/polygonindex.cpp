@@ -0,0 +1,271 @@
+#include "polygonindex.hpp"
+
+#include <algorithm>
+#include <cmath>
+
+#include "utility/geomutils.hpp"
+#include "utility/parallel.hpp"
+
+namespace primitives
+{
+
+namespace
+{
+
+// Distance up to which points count as on the boundary, as in Polygon::contains.
+constexpr double boundaryDistance = 1e-5;
+
+// Positive if <point> is to the left of the line through <from> and <to>.
+double getSide(const Point& from, const Point& to, const Point& point)
+{
+    return (to.x() - from.x()) * (point.y() - from.y()) - (to.y() - from.y()) * (point.x() - from.x());
+}
+
+} // namespace
+
+PolygonContainmentIndex::PolygonContainmentIndex(const Polygon& polygon)
+{
+    for (size_t i = 0; i < polygon.size(); ++i)
+    {
+        m_vertices.push_back(polygon.getVertex(i));
+        m_nextVertices.push_back((i + 1) % polygon.size());
+    }
+    buildGrid();
+}
+
+PolygonContainmentIndex::PolygonContainmentIndex(const MultiPolygon& multiPolygon)
+    : m_vertices(multiPolygon.getCoordinates())
+{
+    for (size_t i = 0; i < m_vertices.size(); ++i)
+    {
+        m_nextVertices.push_back(multiPolygon.getNextVertex(i));
+    }
+    buildGrid();
+}
+
+PolygonContainmentIndex::PolygonContainmentIndex(const MultiPolygon& multiPolygon, size_t ring)
+{
+    size_t ringBegin = multiPolygon.getRingOffsets().at(ring);
+    size_t ringEnd = multiPolygon.getRingOffsets().at(ring + 1);
+    for (size_t v = ringBegin; v < ringEnd; ++v)
+    {
+        m_vertices.push_back(multiPolygon.getCoordinates()[v]);
+        m_nextVertices.push_back(multiPolygon.getNextVertex(v) - ringBegin);
+    }
+    buildGrid();
+}
+
+void PolygonContainmentIndex::buildGrid()
+{
+    size_t numVertices = m_vertices.size();
+    if (numVertices == 0)
+    {
+        // Empty bounding box, so that no point is contained.
+        m_minX = m_minY = 1.;
+        m_maxX = m_maxY = 0.;
+        return;
+    }
+
+    m_minX = m_maxX = m_vertices[0].x();
+    m_minY = m_maxY = m_vertices[0].y();
+    for (const auto& vertex : m_vertices)
+    {
+        m_minX = std::min(m_minX, vertex.x());
+        m_minY = std::min(m_minY, vertex.y());
+        m_maxX = std::max(m_maxX, vertex.x());
+        m_maxY = std::max(m_maxY, vertex.y());
+    }
+    m_minX -= boundaryDistance;
+    m_minY -= boundaryDistance;
+    m_maxX += boundaryDistance;
+    m_maxY += boundaryDistance;
+
+    double width = m_maxX - m_minX;
+    double height = m_maxY - m_minY;
+    m_numCellsX = std::clamp<size_t>(static_cast<size_t>(std::round(std::sqrt(numVertices * width / height))), 1, numVertices);
+    m_numCellsY = std::max<size_t>(1, (numVertices + m_numCellsX - 1) / m_numCellsX);
+    m_cellWidth = width / m_numCellsX;
+    m_cellHeight = height / m_numCellsY;
+
+    auto getColumn = [this](double x)
+    {
+        return std::min(static_cast<size_t>(std::max(0., (x - m_minX) / m_cellWidth)), m_numCellsX - 1);
+    };
+    auto getRow = [this](double y)
+    {
+        return std::min(static_cast<size_t>(std::max(0., (y - m_minY) / m_cellHeight)), m_numCellsY - 1);
+    };
+
+    // Registers every edge in the cells of each row it passes within boundaryDistance of, using the
+    // x-range of the part of the edge inside the row.
+    std::vector<std::vector<size_t>> rowEdges(m_numCellsY);
+    std::vector<std::pair<size_t, size_t>> cellEdgePairs;
+    for (size_t e = 0; e < numVertices; ++e)
+    {
+        const auto& start = m_vertices[e];
+        const auto& end = m_vertices[m_nextVertices[e]];
+        double edgeMinY = std::min(start.y(), end.y());
+        double edgeMaxY = std::max(start.y(), end.y());
+
+        for (size_t row = getRow(edgeMinY - boundaryDistance); row <= getRow(edgeMaxY + boundaryDistance); ++row)
+        {
+            rowEdges[row].push_back(e);
+
+            double rowMinY = std::max(edgeMinY, m_minY + row * m_cellHeight - boundaryDistance);
+            double rowMaxY = std::min(edgeMaxY, m_minY + (row + 1) * m_cellHeight + boundaryDistance);
+            double rowStartX = start.x();
+            double rowEndX = end.x();
+            if (start.y() != end.y())
+            {
+                double slope = (end.x() - start.x()) / (end.y() - start.y());
+                rowStartX = start.x() + (rowMinY - start.y()) * slope;
+                rowEndX = start.x() + (rowMaxY - start.y()) * slope;
+            }
+            size_t firstColumn = getColumn(std::min(rowStartX, rowEndX) - boundaryDistance);
+            size_t lastColumn = getColumn(std::max(rowStartX, rowEndX) + boundaryDistance);
+            for (size_t column = firstColumn; column <= lastColumn; ++column)
+            {
+                cellEdgePairs.emplace_back(getCell(column, row), e);
+            }
+        }
+    }
+
+    size_t numCells = m_numCellsX * m_numCellsY;
+    m_cellEdgeOffsets.assign(numCells + 1, 0);
+    for (const auto& [cell, edge] : cellEdgePairs)
+    {
+        ++m_cellEdgeOffsets[cell + 1];
+    }
+    for (size_t cell = 0; cell < numCells; ++cell)
+    {
+        m_cellEdgeOffsets[cell + 1] += m_cellEdgeOffsets[cell];
+    }
+    m_cellEdges.resize(cellEdgePairs.size());
+    std::vector<size_t> cellFill(m_cellEdgeOffsets.begin(), m_cellEdgeOffsets.end() - 1);
+    for (const auto& [cell, edge] : cellEdgePairs)
+    {
+        m_cellEdges[cellFill[cell]++] = edge;
+    }
+
+    // The reference points of a row lie on a horizontal line through no vertex, in the middle of the widest
+    // gap between the crossings of that line with the edges inside their cell. Their winding number is the
+    // signed number of crossings to their right.
+    m_cellReferencePoints.resize(numCells);
+    m_cellWindingNumbers.resize(numCells);
+    for (size_t row = 0; row < m_numCellsY; ++row)
+    {
+        double referenceY = m_minY + row * m_cellHeight;
+        for (double fraction : {.4142135623730951, .7320508075688772, .2360679774997897, .6180339887498949})
+        {
+            referenceY = m_minY + (row + fraction) * m_cellHeight;
+            bool isThroughVertex = std::any_of(rowEdges[row].begin(), rowEdges[row].end(),
+                                               [this, referenceY](size_t e) { return m_vertices[e].y() == referenceY; });
+            if (!isThroughVertex) break;
+        }
+
+        std::vector<std::pair<double, int>> crossings;
+        for (size_t e : rowEdges[row])
+        {
+            const auto& start = m_vertices[e];
+            const auto& end = m_vertices[m_nextVertices[e]];
+            if ((start.y() > referenceY) == (end.y() > referenceY)) continue;
+
+            double x = start.x() + (referenceY - start.y()) * (end.x() - start.x()) / (end.y() - start.y());
+            crossings.emplace_back(x, end.y() > start.y() ? 1 : -1);
+        }
+        std::sort(crossings.begin(), crossings.end());
+
+        std::vector<int> windingNumbersRight(crossings.size() + 1, 0);
+        for (size_t k = crossings.size(); k > 0; --k)
+        {
+            windingNumbersRight[k - 1] = windingNumbersRight[k] + crossings[k - 1].second;
+        }
+
+        for (size_t column = 0; column < m_numCellsX; ++column)
+        {
+            double cellMinX = m_minX + column * m_cellWidth;
+            double cellMaxX = cellMinX + m_cellWidth;
+            auto crossing = std::lower_bound(crossings.begin(), crossings.end(), std::make_pair(cellMinX, -1));
+
+            double gapStart = cellMinX;
+            double referenceX = (cellMinX + cellMaxX) / 2.;
+            double widestGap = -1.;
+            while (true)
+            {
+                double gapEnd = crossing != crossings.end() ? std::min(crossing->first, cellMaxX) : cellMaxX;
+                if (gapEnd - gapStart > widestGap)
+                {
+                    widestGap = gapEnd - gapStart;
+                    referenceX = (gapStart + gapEnd) / 2.;
+                }
+                if (crossing == crossings.end() || crossing->first >= cellMaxX) break;
+                gapStart = crossing->first;
+                ++crossing;
+            }
+
+            size_t cell = getCell(column, row);
+            m_cellReferencePoints[cell] = Point(referenceX, referenceY);
+            auto firstRight = std::upper_bound(crossings.begin(), crossings.end(), std::make_pair(referenceX, 1));
+            m_cellWindingNumbers[cell] = windingNumbersRight[firstRight - crossings.begin()];
+        }
+    }
+}
+
+bool PolygonContainmentIndex::contains(const Point& point) const
+{
+    if (point.x() < m_minX || point.x() > m_maxX || point.y() < m_minY || point.y() > m_maxY)
+    {
+        return false;
+    }
+
+    size_t column = std::min(static_cast<size_t>((point.x() - m_minX) / m_cellWidth), m_numCellsX - 1);
+    size_t row = std::min(static_cast<size_t>((point.y() - m_minY) / m_cellHeight), m_numCellsY - 1);
+    size_t cell = getCell(column, row);
+
+    for (size_t i = m_cellEdgeOffsets[cell]; i < m_cellEdgeOffsets[cell + 1]; ++i)
+    {
+        size_t e = m_cellEdges[i];
+        if (utility::getSquareDistanceToSegment(point, m_vertices[e], m_vertices[m_nextVertices[e]]) <= boundaryDistance * boundaryDistance)
+        {
+            // Point lies on boundary; we consider it contained
+            return true;
+        }
+    }
+
+    // Walks from the reference point to <point>. Vertices on the line through both count as lying on its right
+    // side, which amounts to moving the walk slightly to the left and makes edges sharing a vertex agree.
+    const auto& reference = m_cellReferencePoints[cell];
+    int windingNumber = m_cellWindingNumbers[cell];
+    for (size_t i = m_cellEdgeOffsets[cell]; i < m_cellEdgeOffsets[cell + 1]; ++i)
+    {
+        size_t e = m_cellEdges[i];
+        const auto& start = m_vertices[e];
+        const auto& end = m_vertices[m_nextVertices[e]];
+        if ((getSide(reference, point, start) > 0.) == (getSide(reference, point, end) > 0.)) continue;
+
+        bool isPointLeft = getSide(start, end, point) > 0.;
+        if (isPointLeft == (getSide(start, end, reference) > 0.)) continue;
+
+        windingNumber += isPointLeft ? 1 : -1;
+    }
+
+    return windingNumber != 0;
+}
+
+std::vector<bool> PolygonContainmentIndex::contains(const std::vector<Point>& points, size_t numThreads) const
+{
+    // std::vector<bool> packs several results into one byte, so the threads write bytes instead.
+    std::vector<char> isContained(points.size());
+    utility::parallelForChunks(points.size(), utility::getNumThreads(numThreads),
+        [&](size_t begin, size_t end, size_t)
+        {
+            for (size_t i = begin; i < end; ++i)
+            {
+                isContained[i] = contains(points[i]);
+            }
+        });
+
+    return std::vector<bool>(isContained.begin(), isContained.end());
+}
+
+} // namespace primitives
@@ -0,0 +1,59 @@
+#ifndef POLYGONINDEX_HPP_INCLUDED
+#define POLYGONINDEX_HPP_INCLUDED
+
+#include <vector>
+
+#include "multipolygon.hpp"
+#include "point.hpp"
+#include "polygon.hpp"
+
+namespace primitives
+{
+
+// Answers Polygon::contains for many points in O(1) expected time per point, with the same result
+// for points on the boundary: those within distance 1e-5 of an edge are contained.
+//
+// The bounding box of the polygon is covered by a uniform grid with about as many cells as the polygon
+// has edges, and every cell stores the edges passing within 1e-5 of it. Every cell also has a reference
+// point, which is not on the boundary, together with its winding number. A query walks from the reference
+// point of its cell to the queried point, and only edges of that cell can be crossed on the way.
+struct PolygonContainmentIndex
+{
+    PolygonContainmentIndex(const Polygon& polygon);
+    // Same for MultiPolygon::contains.
+    PolygonContainmentIndex(const MultiPolygon& multiPolygon);
+    // Same for a single ring of <multiPolygon>, regardless of its orientation.
+    PolygonContainmentIndex(const MultiPolygon& multiPolygon, size_t ring);
+
+    bool contains(const Point& point) const;
+    // Queries all <points> on <numThreads> threads (0 meaning all hardware threads).
+    std::vector<bool> contains(const std::vector<Point>& points, size_t numThreads = 0) const;
+
+private:
+    void buildGrid();
+    size_t getCell(size_t cellX, size_t cellY) const { return cellY * m_numCellsX + cellX; }
+
+    std::vector<Point> m_vertices;
+    // Edge i goes from vertex i to vertex m_nextVertices[i].
+    std::vector<size_t> m_nextVertices;
+
+    double m_minX;
+    double m_minY;
+    double m_maxX;
+    double m_maxY;
+    double m_cellWidth;
+    double m_cellHeight;
+    size_t m_numCellsX;
+    size_t m_numCellsY;
+
+    // The edges of cell c are
+    // m_cellEdges[m_cellEdgeOffsets[c]] to m_cellEdges[m_cellEdgeOffsets[c + 1] - 1].
+    std::vector<size_t> m_cellEdgeOffsets;
+    std::vector<size_t> m_cellEdges;
+    std::vector<Point> m_cellReferencePoints;
+    std::vector<int> m_cellWindingNumbers;
+};
+
+} // namespace primitives
+
+#endif
@@ -0,0 +1,37 @@
+#include "utility/disjointsets.hpp"
+
+#include <numeric>
+#include <utility>
+
+namespace utility
+{
+
+DisjointSets::DisjointSets(size_t size) : m_parents(size), m_sizes(size, 1)
+{
+    std::iota(m_parents.begin(), m_parents.end(), 0);
+}
+
+size_t DisjointSets::find(size_t element)
+{
+    while (m_parents[element] != element)
+    {
+        m_parents[element] = m_parents[m_parents[element]];
+        element = m_parents[element];
+    }
+    return element;
+}
+
+bool DisjointSets::unite(size_t element1, size_t element2)
+{
+    size_t root1 = find(element1);
+    size_t root2 = find(element2);
+    if (root1 == root2) return false;
+
+    if (m_sizes[root1] < m_sizes[root2]) std::swap(root1, root2);
+    m_parents[root2] = root1;
+    m_sizes[root1] += m_sizes[root2];
+
+    return true;
+}
+
+} // namespace utility
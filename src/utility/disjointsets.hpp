@@ -0,0 +1,28 @@
+#ifndef DISJOINT_SETS_HPP_INCLUDED
+#define DISJOINT_SETS_HPP_INCLUDED
+
+#include <cstddef>
+#include <vector>
+
+namespace utility
+{
+
+// Union-find structure over the elements 0, ..., size - 1, using union by size and path halving.
+struct DisjointSets
+{
+    DisjointSets(size_t size);
+
+    size_t find(size_t element);
+
+    // Merges the sets containing <element1> and <element2>.
+    // Returns whether the two elements were in different sets before.
+    bool unite(size_t element1, size_t element2);
+
+private:
+    std::vector<size_t> m_parents;
+    std::vector<size_t> m_sizes;
+};
+
+} // namespace utility
+
+#endif // DISJOINT_SETS_HPP_INCLUDED
@@ -37,4 +37,28 @@ double getAngle(const glm::dvec2& vec1, const glm::dvec2& vec2)
     return std::acos(std::clamp(dot, -1.0, 1.0));
 }
 
+double getSquareDistanceToSegment(const primitives::Point& point, const primitives::Point& start, const primitives::Point& end)
+{
+    double dirX = end.x() - start.x();
+    double dirY = end.y() - start.y();
+    double squareLength = dirX * dirX + dirY * dirY;
+    if (squareLength == 0.)
+    {
+        return point.squareDistance(start);
+    }
+    double param = ((point.x() - start.x()) * dirX + (point.y() - start.y()) * dirY) / squareLength;
+    param = std::clamp(param, 0., 1.);
+    return point.squareDistance(primitives::Point(start.x() + param * dirX, start.y() + param * dirY));
+}
+
+int getWindingNumberStep(const primitives::Point& point, const primitives::Point& start, const primitives::Point& end)
+{
+    if ((start.y() > point.y()) == (end.y() > point.y())) return 0;
+
+    double crossingX = start.x() + (point.y() - start.y()) * (end.x() - start.x()) / (end.y() - start.y());
+    if (crossingX <= point.x()) return 0;
+
+    return start.y() < end.y() ? 1 : -1;
+}
+
 } // namespace utility
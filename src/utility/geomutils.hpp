@@ -16,6 +16,14 @@ primitives::Point toPoint(glm::dvec2 vec);
 
 double getAngle(const glm::dvec2& vec1, const glm::dvec2& vec2);
 
+// Square of the distance from <point> to the line segment from <start> to <end>, which may have length 0.
+double getSquareDistanceToSegment(const primitives::Point& point, const primitives::Point& start, const primitives::Point& end);
+
+// Contribution of the edge from <start> to <end> to the winding number of <point>: 1 resp. -1 if the edge crosses
+// the ray to the right of the point upwards resp. downwards, else 0. Edges only contain their upper end point, so
+// that a ray through a vertex is counted once, and not at all for horizontal edges.
+int getWindingNumberStep(const primitives::Point& point, const primitives::Point& start, const primitives::Point& end);
+
 } // namespace utility
 
 #endif
\ No newline at end of file
@@ -1,7 +1,11 @@
 #include "io.hpp"
 
+#include <algorithm>
 #include <array>
+#include <cstdint>
+#include <cstring>
 #include <fstream>
+#include <numeric>
 
 namespace utility 
 {
@@ -149,4 +153,99 @@ void writeTriangulationToFile(
   oStream.close();
 }
 
+namespace priv
+{
+
+constexpr char lineSegmentFileTag[4] = {'J', 'J', 'L', 'S'};
+
+primitives::Point getUpperEndPoint(const primitives::LineSegment &line)
+{
+  return line.getStartPoint() < line.getEndPoint() ? line.getStartPoint()
+                                                   : line.getEndPoint();
+}
+
+} // namespace priv
+
+std::vector<size_t> writeLineSegmentsToBinaryFile(
+    const std::vector<primitives::LineSegment> &lines, fs::path outPath)
+{
+  std::vector<size_t> order(lines.size());
+  std::iota(order.begin(), order.end(), 0);
+  std::stable_sort(order.begin(), order.end(), [&lines](size_t lhs, size_t rhs) {
+    // Exact comparison, since operator< for Points uses a tolerance and thus
+    // is no strict weak ordering.
+    auto lhsPoint = priv::getUpperEndPoint(lines[lhs]);
+    auto rhsPoint = priv::getUpperEndPoint(lines[rhs]);
+    if (lhsPoint.y() != rhsPoint.y())
+    {
+      return lhsPoint.y() > rhsPoint.y();
+    }
+    return lhsPoint.x() < rhsPoint.x();
+  });
+
+  std::ofstream file(outPath, std::ios::binary);
+  if (!file.is_open())
+  {
+    throw std::runtime_error("Could not open file for writing line segments.");
+  }
+
+  file.write(priv::lineSegmentFileTag, sizeof(priv::lineSegmentFileTag));
+  uint64_t numLines = lines.size();
+  file.write(reinterpret_cast<const char *>(&numLines), sizeof(numLines));
+  for (size_t idx : order)
+  {
+    const auto &line = lines[idx];
+    std::array<double, 4> record = {line.getStartPoint().x(), line.getStartPoint().y(),
+                                    line.getEndPoint().x(), line.getEndPoint().y()};
+    file.write(reinterpret_cast<const char *>(record.data()),
+               sizeof(double) * record.size());
+  }
+
+  if (!file)
+  {
+    throw std::runtime_error("Failed writing line segments to file.");
+  }
+
+  return order;
+}
+
+LineSegmentFileReader::LineSegmentFileReader(fs::path inPath)
+    : m_file(inPath, std::ios::binary)
+{
+  if (!m_file.is_open())
+  {
+    throw std::runtime_error("Could not open line segment file.");
+  }
+
+  char tag[sizeof(priv::lineSegmentFileTag)];
+  uint64_t numLines = 0;
+  m_file.read(tag, sizeof(tag));
+  m_file.read(reinterpret_cast<char *>(&numLines), sizeof(numLines));
+  if (!m_file || std::memcmp(tag, priv::lineSegmentFileTag, sizeof(tag)) != 0)
+  {
+    throw std::runtime_error("Invalid line segment file header.");
+  }
+  m_numLines = numLines;
+}
+
+std::optional<primitives::LineSegment> LineSegmentFileReader::readNext()
+{
+  if (m_numRead == m_numLines)
+  {
+    return std::nullopt;
+  }
+
+  std::array<double, 4> record;
+  m_file.read(reinterpret_cast<char *>(record.data()),
+              sizeof(double) * record.size());
+  if (!m_file)
+  {
+    throw std::runtime_error("Line segment file ended before all records were read.");
+  }
+  ++m_numRead;
+
+  return primitives::LineSegment(primitives::Point(record[0], record[1]),
+                                 primitives::Point(record[2], record[3]));
+}
+
 } // namespace utility
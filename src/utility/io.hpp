@@ -2,8 +2,11 @@
 #define IO_HPP_INCLUDED
 
 #include "algorithms/delaunay/triangulation.hpp"
+#include "primitives/linesegment.hpp"
 
 #include <filesystem>
+#include <fstream>
+#include <optional>
 
 namespace fs = std::filesystem;
 
@@ -45,6 +48,33 @@ void loadTriangulationFromFile(fs::path inPath, algorithms::DelaunayTriangulator
 // where v0, v1 and v2 are indices of vertices in the point list.
 void writeTriangulationToFile(const algorithms::DelaunayTriangulator& triangulation, fs::path outPath);
 
+// Binary line segment files, meant for data sets too large to be kept in memory.
+// Format: The four characters "JJLS", the number of line segments as a uint64_t and
+// then one record <start.x> <start.y> <end.x> <end.y> of doubles per line segment,
+// all in native byte order. The records are sorted by their upper end point in the
+// order the plane sweep processes them, i. e., by decreasing y and then increasing x,
+// so that the file can be swept while it is being read.
+//
+// Writes <lines> in sorted order and returns, for every record in the file, the index
+// of the line segment in <lines> it was written from.
+std::vector<size_t> writeLineSegmentsToBinaryFile(const std::vector<primitives::LineSegment>& lines, fs::path outPath);
+
+// Reads the records of a binary line segment file one at a time.
+struct LineSegmentFileReader
+{
+  LineSegmentFileReader(fs::path inPath);
+
+  size_t getNumLines() const { return m_numLines; }
+
+  // The next line segment in the file, or std::nullopt once all have been read.
+  std::optional<primitives::LineSegment> readNext();
+
+private:
+  std::ifstream m_file;
+  size_t m_numLines = 0;
+  size_t m_numRead = 0;
+};
+
 } // namespace utility
 
 #endif // IO_HPP_INCLUDED
\ No newline at end of file
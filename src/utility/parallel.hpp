@@ -0,0 +1,62 @@
+#ifndef PARALLEL_HPP_INCLUDED
+#define PARALLEL_HPP_INCLUDED
+
+#include <algorithm>
+#include <exception>
+#include <thread>
+#include <vector>
+
+namespace utility
+{
+
+// Number of threads to use when <requestedThreads> threads are asked for. 0 means "as many as the hardware has".
+inline size_t getNumThreads(size_t requestedThreads = 0)
+{
+    if (requestedThreads > 0) return requestedThreads;
+
+    return std::max<size_t>(1, std::thread::hardware_concurrency());
+}
+
+// Splits [0, count) into <numChunks> contiguous chunks of (almost) equal size and calls
+// func(chunkBegin, chunkEnd, chunkIdx) for each of them on its own thread. The calling thread takes the first chunk.
+// Exceptions thrown by <func> are rethrown on the calling thread once all chunks are done.
+template<typename Func>
+void parallelForChunks(size_t count, size_t numChunks, Func&& func)
+{
+    numChunks = std::max<size_t>(1, numChunks);
+    auto chunkBegin = [count, numChunks](size_t chunkIdx) { return count * chunkIdx / numChunks; };
+
+    std::vector<std::exception_ptr> exceptions(numChunks);
+    auto runChunk = [&](size_t chunkIdx)
+    {
+        try
+        {
+            func(chunkBegin(chunkIdx), chunkBegin(chunkIdx + 1), chunkIdx);
+        }
+        catch (...)
+        {
+            exceptions[chunkIdx] = std::current_exception();
+        }
+    };
+
+    std::vector<std::thread> threads;
+    threads.reserve(numChunks - 1);
+    for (size_t chunkIdx = 1; chunkIdx < numChunks; ++chunkIdx)
+    {
+        threads.emplace_back(runChunk, chunkIdx);
+    }
+    runChunk(0);
+
+    for (auto& thread : threads)
+    {
+        thread.join();
+    }
+    for (const auto& exception : exceptions)
+    {
+        if (exception) std::rethrow_exception(exception);
+    }
+}
+
+} // namespace utility
+
+#endif // PARALLEL_HPP_INCLUDED